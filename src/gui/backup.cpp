@@ -30,11 +30,26 @@
 #include <mz_zip.h>
 #include <mz_zip_rw.h>
 
+#include <loot/exception/file_access_error.h>
+#include <toml++/toml.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
 #include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
 
+#include "gui/qt/helpers.h"
 #include "gui/state/logging.h"
 
 namespace loot {
+static constexpr const char* BACKUP_OBJECTS_DIR = "objects";
+static constexpr const char* BACKUP_MANIFESTS_DIR = "manifests";
+static constexpr const char* BACKUP_MANIFEST_EXTENSION = ".toml";
+static constexpr const char* BACKUP_MANIFEST_FILES_KEY = "files";
+
 std::filesystem::path compressDirectory(const std::filesystem::path& dir) {
   auto archivePath = dir;
   archivePath += ".zip";
@@ -85,15 +100,11 @@ std::filesystem::path compressDirectory(const std::filesystem::path& dir) {
   return archivePath;
 }
 
-void createBackup(const std::filesystem::path& sourceDir,
-                  const std::filesystem::path& destDir) {
+std::vector<std::filesystem::path> getFilesToBackup(
+    const std::filesystem::path& sourceDir) {
   auto logger = getLogger();
-  if (logger) {
-    logger->trace("Creating backup of {} in {}",
-                  sourceDir.u8string(),
-                  destDir.u8string());
-  }
 
+  std::vector<std::filesystem::path> paths;
   for (auto it = std::filesystem::recursive_directory_iterator(sourceDir);
        it != std::filesystem::recursive_directory_iterator();
        ++it) {
@@ -120,6 +131,50 @@ void createBackup(const std::filesystem::path& sourceDir,
       continue;
     }
 
+    paths.push_back(path);
+  }
+
+  return paths;
+}
+
+QByteArray readBackupSourceFile(const std::filesystem::path& path) {
+  QFile file(QString::fromStdString(path.u8string()));
+
+  if (!file.open(QIODevice::ReadOnly)) {
+    throw FileAccessError(path.u8string() + " could not be opened for reading");
+  }
+
+  return file.readAll();
+}
+
+void writeBackupFile(const std::filesystem::path& path,
+                     const QByteArray& data) {
+  QFile file(QString::fromStdString(path.u8string()));
+
+  if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size()) {
+    throw FileAccessError(path.u8string() + " could not be written");
+  }
+}
+
+std::filesystem::path getBackupObjectPath(
+    const std::filesystem::path& backupsDir,
+    const std::string& blobHash) {
+  // Split the hash in the same way as Git's loose object store so that no
+  // single directory ends up with a huge number of entries.
+  return backupsDir / BACKUP_OBJECTS_DIR / blobHash.substr(0, 2) /
+         blobHash.substr(2);
+}
+
+void createBackup(const std::filesystem::path& sourceDir,
+                  const std::filesystem::path& destDir) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->trace("Creating backup of {} in {}",
+                  sourceDir.u8string(),
+                  destDir.u8string());
+  }
+
+  for (const auto& path : getFilesToBackup(sourceDir)) {
     auto destPath = destDir / path.lexically_relative(sourceDir);
 
     std::filesystem::create_directories(destPath.parent_path());
@@ -132,4 +187,200 @@ void createBackup(const std::filesystem::path& sourceDir,
         "Backup of {} created in {}", sourceDir.u8string(), destDir.u8string());
   }
 }
+
+std::optional<std::filesystem::path> createIncrementalBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& backupsDir,
+    const std::string& backupName) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->trace("Creating incremental backup of {} in {}",
+                  sourceDir.u8string(),
+                  backupsDir.u8string());
+  }
+
+  BackupManifest manifest;
+  size_t newObjectsCount = 0;
+
+  for (const auto& path : getFilesToBackup(sourceDir)) {
+    // Hash the raw file content rather than using the path overload of
+    // calculateGitBlobHash(), as that normalises line endings and the
+    // backup must preserve files exactly.
+    const auto content = readBackupSourceFile(path);
+    const auto blobHash = calculateGitBlobHash(content);
+
+    const auto objectPath = getBackupObjectPath(backupsDir, blobHash);
+    if (!std::filesystem::exists(objectPath)) {
+      std::filesystem::create_directories(objectPath.parent_path());
+
+      // Write to a temporary path first so that an interrupted backup can't
+      // leave behind a truncated object that later backups would reuse.
+      auto tempPath = objectPath;
+      tempPath += ".tmp";
+      writeBackupFile(tempPath, content);
+      std::filesystem::rename(tempPath, objectPath);
+
+      newObjectsCount += 1;
+    }
+
+    manifest.files.emplace(
+        path.lexically_relative(sourceDir).generic_u8string(), blobHash);
+  }
+
+  if (manifest.files.empty()) {
+    if (logger) {
+      logger->info("No files found in {}, not creating a backup",
+                   sourceDir.u8string());
+    }
+    return std::nullopt;
+  }
+
+  toml::table files;
+  for (const auto& [relativePath, blobHash] : manifest.files) {
+    files.insert(relativePath, blobHash);
+  }
+
+  const auto manifestPath =
+      backupsDir / BACKUP_MANIFESTS_DIR /
+      std::filesystem::u8path(backupName + BACKUP_MANIFEST_EXTENSION);
+
+  std::filesystem::create_directories(manifestPath.parent_path());
+
+  std::stringstream manifestContent;
+  manifestContent << toml::table{{BACKUP_MANIFEST_FILES_KEY, files}};
+
+  // Like objects, write the manifest to a temporary path first so that an
+  // interrupted backup can't leave behind a truncated manifest.
+  auto tempPath = manifestPath;
+  tempPath += ".tmp";
+  writeBackupFile(tempPath, QByteArray::fromStdString(manifestContent.str()));
+  std::filesystem::rename(tempPath, manifestPath);
+
+  if (logger) {
+    logger->info(
+        "Incremental backup of {} created at {}, {} of {} files needed new "
+        "objects",
+        sourceDir.u8string(),
+        manifestPath.u8string(),
+        newObjectsCount,
+        manifest.files.size());
+  }
+
+  return manifestPath;
+}
+
+BackupManifest readBackupManifest(const std::filesystem::path& manifestPath) {
+  // Don't use toml::parse_file() as it just uses a std stream,
+  // which don't support UTF-8 paths on Windows.
+  std::ifstream in(manifestPath);
+  if (!in.is_open()) {
+    throw std::runtime_error(manifestPath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  const auto table = toml::parse(in, manifestPath.u8string());
+
+  const auto files = table[BACKUP_MANIFEST_FILES_KEY].as_table();
+  if (!files) {
+    throw std::runtime_error("files table is missing");
+  }
+
+  BackupManifest manifest;
+  for (const auto& [key, value] : *files) {
+    const auto blobHash = value.value<std::string>();
+    if (!blobHash.has_value()) {
+      throw std::runtime_error("blob hash for \"" + std::string(key.str()) +
+                               "\" is not a string");
+    }
+
+    // The hash is used to build the object's path, so only accept hex digits
+    // to stop it from pointing outside the objects directory.
+    static constexpr size_t GIT_BLOB_HASH_LENGTH = 40;
+    const auto isHexDigit = [](char c) {
+      return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+             (c >= 'A' && c <= 'F');
+    };
+    if (blobHash.value().size() != GIT_BLOB_HASH_LENGTH ||
+        !std::all_of(
+            blobHash.value().begin(), blobHash.value().end(), isHexDigit)) {
+      throw std::runtime_error("blob hash for \"" + std::string(key.str()) +
+                               "\" is not a valid SHA-1 hash");
+    }
+
+    manifest.files.emplace(std::string(key.str()), blobHash.value());
+  }
+
+  return manifest;
+}
+
+void restoreBackup(const std::filesystem::path& manifestPath,
+                   const std::filesystem::path& destDir) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->trace("Restoring backup from {} to {}",
+                  manifestPath.u8string(),
+                  destDir.u8string());
+  }
+
+  const auto backupsDir = manifestPath.parent_path().parent_path();
+  const auto manifest = readBackupManifest(manifestPath);
+
+  for (const auto& [relativePath, blobHash] : manifest.files) {
+    // Guard against the manifest being edited to point outside destDir.
+    const auto path = std::filesystem::u8path(relativePath).lexically_normal();
+    if (path.empty() || path.has_root_path() || *path.begin() == "..") {
+      throw std::runtime_error("Backup manifest path \"" + relativePath +
+                               "\" is not a relative path inside the backup");
+    }
+
+    const auto objectPath = getBackupObjectPath(backupsDir, blobHash);
+    const auto destPath = destDir / path;
+
+    std::filesystem::create_directories(destPath.parent_path());
+
+    std::filesystem::copy_file(
+        objectPath,
+        destPath,
+        std::filesystem::copy_options::overwrite_existing);
+  }
+
+  if (logger) {
+    logger->info("Restored {} files from {} to {}",
+                 manifest.files.size(),
+                 manifestPath.u8string(),
+                 destDir.u8string());
+  }
+}
+
+std::filesystem::path exportBackup(const std::filesystem::path& manifestPath,
+                                   const std::filesystem::path& destDir) {
+  // Stage the restored files in a new uniquely-named directory so that
+  // nothing already in destDir is overwritten or deleted. The directory and
+  // its content are removed when it goes out of scope, even if restoring or
+  // compressing fails.
+  auto templatePath = destDir / manifestPath.stem();
+  templatePath += "-XXXXXX";
+
+  const QTemporaryDir tempDir(QString::fromStdString(templatePath.u8string()));
+  if (!tempDir.isValid()) {
+    throw std::runtime_error("Failed to create a temporary directory in " +
+                             destDir.u8string() + ": " +
+                             tempDir.errorString().toStdString());
+  }
+
+  const auto stagingDir =
+      std::filesystem::u8path(tempDir.path().toStdString()) /
+      manifestPath.stem();
+
+  restoreBackup(manifestPath, stagingDir);
+
+  const auto stagedZipPath = compressDirectory(stagingDir);
+
+  auto zipPath = destDir / manifestPath.stem();
+  zipPath += ".zip";
+
+  std::filesystem::rename(stagedZipPath, zipPath);
+
+  return zipPath;
+}
 }
@@ -27,12 +27,42 @@
 #define LOOT_GUI_BACKUP
 
 #include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
 
 namespace loot {
+struct BackupManifest {
+  // Maps file paths relative to the backed-up directory to the Git blob hashes
+  // of their content.
+  std::map<std::string, std::string> files;
+};
+
 std::filesystem::path compressDirectory(const std::filesystem::path& dir);
 
 void createBackup(const std::filesystem::path& sourceDir,
                   const std::filesystem::path& destDir);
+
+// Stores the content of each file in sourceDir in an object store in
+// backupsDir, keyed by its Git blob hash so that unchanged files are only
+// stored once across all backups, then writes a manifest named backupName
+// that maps the files' paths to their hashes. Returns the path to the
+// manifest, or nullopt if there were no files to back up.
+std::optional<std::filesystem::path> createIncrementalBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& backupsDir,
+    const std::string& backupName);
+
+BackupManifest readBackupManifest(const std::filesystem::path& manifestPath);
+
+// Recreates the files recorded in the given manifest in destDir.
+void restoreBackup(const std::filesystem::path& manifestPath,
+                   const std::filesystem::path& destDir);
+
+// Restores the given backup to a temporary directory in destDir and
+// compresses it to a zip file in destDir, returning the zip file's path.
+std::filesystem::path exportBackup(const std::filesystem::path& manifestPath,
+                                   const std::filesystem::path& destDir);
 }
 
 #endif
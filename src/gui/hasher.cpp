@@ -0,0 +1,90 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/hasher.h"
+
+#include <array>
+#include <fstream>
+
+namespace {
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+}
+
+namespace loot {
+void Hasher::Add(std::string_view value) {
+  // Include the length so that the boundaries between values are unambiguous.
+  Add(static_cast<uint64_t>(value.size()));
+  AddBytes(value.data(), value.size());
+}
+
+void Hasher::Add(uint64_t value) {
+  AddBytes(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+void Hasher::AddFileContent(const std::filesystem::path& filePath) {
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    Add(uint64_t{0});
+    return;
+  }
+
+  Add(uint64_t{1});
+
+  std::array<char, 65536> buffer{};
+  while (in) {
+    in.read(buffer.data(), buffer.size());
+    AddBytes(buffer.data(), static_cast<size_t>(in.gcount()));
+  }
+}
+
+void Hasher::AddFileState(const std::filesystem::path& filePath) {
+  std::error_code errorCode;
+  const auto size = std::filesystem::file_size(filePath, errorCode);
+  if (errorCode) {
+    Add(uint64_t{0});
+    return;
+  }
+
+  const auto lastWriteTime =
+      std::filesystem::last_write_time(filePath, errorCode);
+  if (errorCode) {
+    Add(uint64_t{0});
+    return;
+  }
+
+  Add(uint64_t{1});
+  Add(static_cast<uint64_t>(size));
+  Add(static_cast<uint64_t>(lastWriteTime.time_since_epoch().count()));
+}
+
+uint64_t Hasher::GetHash() const { return hash_; }
+
+void Hasher::AddBytes(const char* bytes, size_t length) {
+  for (size_t i = 0; i < length; i += 1) {
+    hash_ ^= static_cast<uint8_t>(bytes[i]);
+    hash_ *= FNV_PRIME;
+  }
+}
+}
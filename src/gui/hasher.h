@@ -0,0 +1,57 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_HASHER
+#define LOOT_GUI_HASHER
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace loot {
+// Builds a hash of a sequence of values and file states, e.g. to check if the
+// inputs to a cached result have changed. The hash doesn't depend on anything
+// that changes between runs of LOOT, so it can be saved.
+class Hasher {
+public:
+  void Add(std::string_view value);
+  void Add(uint64_t value);
+
+  // Hash the file's content, or that it doesn't exist.
+  void AddFileContent(const std::filesystem::path& filePath);
+  // Hash the file's size and last write time, or that it doesn't exist.
+  void AddFileState(const std::filesystem::path& filePath);
+
+  uint64_t GetHash() const;
+
+private:
+  void AddBytes(const char* bytes, size_t length);
+
+  // FNV-1a is fast and good enough to detect changes.
+  uint64_t hash_{14695981039346656037ULL};
+};
+}
+
+#endif
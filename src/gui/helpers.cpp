@@ -52,10 +52,37 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
 #include <fstream>
+#include <future>
+#include <set>
+#include <thread>
 
 #include "gui/state/logging.h"
 
 namespace {
+#ifndef _WIN32
+bool IsSkippedFilesystemType(const std::string& type) {
+  // Pseudo filesystems, and those that snaps and other images are mounted as.
+  static const std::set<std::string> SKIPPED_TYPES{
+      "autofs",   "binfmt_misc", "bpf",       "cgroup",     "cgroup2",
+      "configfs", "debugfs",     "devpts",    "devtmpfs",   "efivarfs",
+      "fusectl",  "hugetlbfs",   "iso9660",   "mqueue",     "nsfs",
+      "proc",     "pstore",      "ramfs",     "rpc_pipefs", "securityfs",
+      "squashfs", "sysfs",       "tmpfs",     "tracefs",    "udf",
+      // Remote filesystems.
+      "9p",       "afs",         "ceph",      "cifs",       "davfs",
+      "fuse",     "glusterfs",   "ncpfs",     "nfs",        "nfs4",
+      "smb3",     "smbfs"};
+
+  // FUSE filesystems like sshfs and rclone are usually remote (local disks
+  // mounted using FUSE have the fuseblk type).
+  return SKIPPED_TYPES.count(type) != 0 || boost::starts_with(type, "fuse.");
+}
+
+bool IsLoopDevice(const std::string& deviceName) {
+  return boost::starts_with(deviceName, "/dev/loop");
+}
+#endif
+
 #ifdef _WIN32
 std::vector<std::wstring> SplitOnNulls(std::vector<wchar_t> nullDelimitedList) {
   std::vector<std::wstring> elements;
@@ -143,6 +170,127 @@ const char* getDriveTypeText(UINT driveType) {
   }
 }
 #endif
+
+// This doesn't log anything, so that it can be run on a thread that may
+// outlive logging.
+std::optional<std::vector<uint8_t>> ReadXboxGamingRootFile(
+    const std::filesystem::path& gamingRootFilePath) {
+  if (!std::filesystem::is_regular_file(gamingRootFilePath)) {
+    return std::nullopt;
+  }
+
+  std::ifstream in(gamingRootFilePath, std::ios::binary);
+
+  std::vector<uint8_t> bytes;
+  std::copy(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>(),
+            std::back_inserter(bytes));
+
+  return bytes;
+}
+
+// readBytes is called to get the result of ReadXboxGamingRootFile() for the
+// drive's .GamingRoot file.
+template<typename F>
+std::optional<std::filesystem::path> GetXboxGamingRootPath(
+    const std::filesystem::path& driveRootPath,
+    F readBytes) {
+  const auto logger = loot::getLogger();
+  const auto gamingRootFilePath = driveRootPath / ".GamingRoot";
+
+  std::vector<uint8_t> bytes;
+
+  try {
+    auto maybeBytes = readBytes();
+    if (!maybeBytes.has_value()) {
+      return std::nullopt;
+    }
+
+    bytes = std::move(maybeBytes.value());
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to read file at {}: {}",
+                    gamingRootFilePath.u8string(),
+                    e.what());
+    }
+
+    // Don't propagate this error as it could be due to a legitimate failure
+    // case like the drive not being ready (e.g. a removable disk drive with
+    // nothing in it).
+    return std::nullopt;
+  }
+
+  if (logger) {
+    // Log the contents of .GamingRoot because I'm not sure of the format and
+    // this would help debugging.
+    logger->debug("Read the following bytes from {}: {::#04x}",
+                  gamingRootFilePath.u8string(),
+                  bytes);
+  }
+
+  // The content of .GamingRoot seems to be the byte sequence 52 47 42 58 01 00
+  // 00 00 followed by the null-terminated UTF-16LE location of the Xbox games
+  // folder on the same drive.
+
+  if (bytes.size() % 2 != 0) {
+    if (logger) {
+      logger->error(
+          "Found a non-even number of bytes in the file at {}, cannot "
+          "interpret it as UTF-16LE",
+          gamingRootFilePath.u8string());
+    }
+
+    return std::nullopt;
+  }
+
+  std::vector<char16_t> content;
+  for (size_t i = 0; i < bytes.size(); i += 2) {
+    // char16_t is little-endian on all platforms LOOT runs on.
+    char16_t highByte = bytes.at(i);
+    char16_t lowByte = bytes.at(i + 1);
+    char16_t value = highByte | (lowByte << CHAR_BIT);
+    content.push_back(value);
+  }
+
+  static constexpr size_t CHAR16_PATH_OFFSET = 4;
+  if (content.size() < CHAR16_PATH_OFFSET + 1) {
+    if (logger) {
+      logger->error(
+          ".GamingRoot content was unexpectedly short at {} char16_t long",
+          content.size());
+    }
+
+    return std::nullopt;
+  }
+
+  // Cut off the null char16_t at the end.
+  const std::u16string relativePath(content.begin() + CHAR16_PATH_OFFSET,
+                                    content.end() - 1);
+
+  // Check that the string does not contain any nul characters (i.e. 0x00 0x00
+  // in UTF-16), as while they're valid in UTF-16, they'll be passed around as
+  // a C string later, and nul characters are not allowed in Windows or Linux
+  // paths.
+  const auto containsNul =
+      std::find(relativePath.begin(), relativePath.end(), char16_t{0}) !=
+      relativePath.end();
+  if (containsNul) {
+    if (logger) {
+      logger->error(
+          "The relative path read from .GamingRoot contains a nul "
+          "character");
+    }
+
+    return std::nullopt;
+  }
+
+  if (logger) {
+    logger->debug("Read the following relative path from .GamingRoot: {}",
+                  std::filesystem::path(relativePath).u8string());
+  }
+
+  return driveRootPath / relativePath;
+}
 }
 
 namespace loot {
@@ -264,7 +412,8 @@ std::vector<std::string> GetPreferredUILanguages() {
 #endif
 }
 
-std::vector<std::filesystem::path> GetDriveRootPaths() {
+std::vector<std::filesystem::path> GetDriveRootPaths(
+    [[maybe_unused]] const std::vector<std::string>& allowedFilesystemTypes) {
 #ifdef _WIN32
   const auto maxBufferLength = GetLogicalDriveStrings(0, nullptr);
 
@@ -326,9 +475,26 @@ std::vector<std::filesystem::path> GetDriveRootPaths() {
   std::array<char, BUFFER_SIZE> stringsBuffer{};
   std::vector<std::filesystem::path> paths;
 
+  const auto logger = getLogger();
   while (getmntent_r(
              mountsFile, &entry, stringsBuffer.data(), stringsBuffer.size()) !=
          nullptr) {
+    const std::string type = entry.mnt_type;
+    const auto isAllowed =
+        std::find(allowedFilesystemTypes.begin(),
+                  allowedFilesystemTypes.end(),
+                  type) != allowedFilesystemTypes.end();
+
+    if (!isAllowed &&
+        (IsSkippedFilesystemType(type) || IsLoopDevice(entry.mnt_fsname))) {
+      if (logger) {
+        logger->debug("Skipping mount point {} as it has filesystem type {}",
+                      entry.mnt_dir,
+                      type);
+      }
+      continue;
+    }
+
     paths.push_back(entry.mnt_dir);
   }
 
@@ -340,102 +506,72 @@ std::vector<std::filesystem::path> GetDriveRootPaths() {
 
 std::optional<std::filesystem::path> FindXboxGamingRootPath(
     const std::filesystem::path& driveRootPath) {
-  const auto logger = getLogger();
-  const auto gamingRootFilePath = driveRootPath / ".GamingRoot";
-
-  std::vector<uint8_t> bytes;
-
-  try {
-    if (!std::filesystem::is_regular_file(gamingRootFilePath)) {
-      return std::nullopt;
-    }
-
-    std::ifstream in(gamingRootFilePath, std::ios::binary);
-
-    std::copy(std::istreambuf_iterator<char>(in),
-              std::istreambuf_iterator<char>(),
-              std::back_inserter(bytes));
-  } catch (const std::exception& e) {
-    if (logger) {
-      logger->error("Failed to read file at {}: {}",
-                    gamingRootFilePath.u8string(),
-                    e.what());
-    }
-
-    // Don't propagate this error as it could be due to a legitimate failure
-    // case like the drive not being ready (e.g. a removable disk drive with
-    // nothing in it).
-    return std::nullopt;
-  }
-
-  if (logger) {
-    // Log the contents of .GamingRoot because I'm not sure of the format and
-    // this would help debugging.
-    logger->debug("Read the following bytes from {}: {::#04x}",
-                  gamingRootFilePath.u8string(),
-                  bytes);
-  }
-
-  // The content of .GamingRoot seems to be the byte sequence 52 47 42 58 01 00
-  // 00 00 followed by the null-terminated UTF-16LE location of the Xbox games
-  // folder on the same drive.
-
-  if (bytes.size() % 2 != 0) {
-    logger->error(
-        "Found a non-even number of bytes in the file at {}, cannot interpret "
-        "it as UTF-16LE",
-        gamingRootFilePath.u8string());
-
-    return std::nullopt;
-  }
+  return GetXboxGamingRootPath(driveRootPath, [&driveRootPath]() {
+    return ReadXboxGamingRootFile(driveRootPath / ".GamingRoot");
+  });
+}
 
-  std::vector<char16_t> content;
-  for (size_t i = 0; i < bytes.size(); i += 2) {
-    // char16_t is little-endian on all platforms LOOT runs on.
-    char16_t highByte = bytes.at(i);
-    char16_t lowByte = bytes.at(i + 1);
-    char16_t value = highByte | (lowByte << CHAR_BIT);
-    content.push_back(value);
+std::vector<std::filesystem::path> FindXboxGamingRootPaths(
+    const std::vector<std::filesystem::path>& driveRootPaths,
+    std::chrono::milliseconds timeout,
+    const std::vector<std::filesystem::path>& previousRootPaths) {
+  // Run each probe on a detached thread so that a probe that never finishes
+  // doesn't block, as the destructor of a future from std::async would. A
+  // probe of a drive that hangs is leaked, which is accepted because there's
+  // no portable way to cancel blocking file I/O. Probes only read files, and
+  // their results are interpreted and logged on this thread, so a leaked probe
+  // never uses logging, which may have been shut down by the time it finishes.
+  std::vector<std::future<std::optional<std::vector<uint8_t>>>> futures;
+  futures.reserve(driveRootPaths.size());
+  for (const auto& driveRootPath : driveRootPaths) {
+    std::packaged_task<std::optional<std::vector<uint8_t>>()> task(
+        [gamingRootFilePath = driveRootPath / ".GamingRoot"]() {
+          return ReadXboxGamingRootFile(gamingRootFilePath);
+        });
+    futures.push_back(task.get_future());
+    std::thread(std::move(task)).detach();
   }
 
-  static constexpr size_t CHAR16_PATH_OFFSET = 4;
-  if (content.size() < CHAR16_PATH_OFFSET + 1) {
-    if (logger) {
-      logger->error(
-          ".GamingRoot content was unexpectedly short at {} char16_t long",
-          content.size());
+  const auto logger = getLogger();
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::vector<std::filesystem::path> rootPaths;
+  for (size_t i = 0; i < futures.size(); i += 1) {
+    const auto& driveRootPath = driveRootPaths.at(i);
+    auto& future = futures.at(i);
+
+    if (future.wait_until(deadline) == std::future_status::ready) {
+      const auto rootPath = GetXboxGamingRootPath(
+          driveRootPath, [&future]() { return future.get(); });
+      if (rootPath.has_value()) {
+        rootPaths.push_back(rootPath.value());
+      }
+      continue;
     }
 
-    return std::nullopt;
-  }
-
-  // Cut off the null char16_t at the end.
-  const std::u16string relativePath(content.begin() + CHAR16_PATH_OFFSET,
-                                    content.end() - 1);
-
-  // Check that the string does not contain any nul characters (i.e. 0x00 0x00
-  // in UTF-16), as while they're valid in UTF-16, they'll be passed around as
-  // a C string later, and nul characters are not allowed in Windows or Linux
-  // paths.
-  const auto containsNul =
-      std::find(relativePath.begin(), relativePath.end(), char16_t{0}) !=
-      relativePath.end();
-  if (containsNul) {
     if (logger) {
-      logger->error(
-          "The relative path read from .GamingRoot contains a nul "
-          "character");
+      logger->warn(
+          "Timed out looking for an Xbox gaming root path on {}, using any "
+          "that was previously found on it",
+          driveRootPath.u8string());
     }
 
-    return std::nullopt;
-  }
-
-  if (logger) {
-    logger->debug("Read the following relative path from .GamingRoot: {}",
-                  std::filesystem::path(relativePath).u8string());
+    for (const auto& previousRootPath : previousRootPaths) {
+      const auto isOnDrive = std::mismatch(driveRootPath.begin(),
+                                           driveRootPath.end(),
+                                           previousRootPath.begin(),
+                                           previousRootPath.end())
+                                 .first == driveRootPath.end();
+      const auto isFound =
+          std::find(rootPaths.begin(), rootPaths.end(), previousRootPath) !=
+          rootPaths.end();
+
+      if (isOnDrive && !isFound) {
+        rootPaths.push_back(previousRootPath);
+      }
+    }
   }
 
-  return driveRootPath / relativePath;
+  return rootPaths;
 }
 
 int CompareFilenames(const std::string& lhs, const std::string& rhs) {
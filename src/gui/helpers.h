@@ -27,8 +27,10 @@
 
 #include <loot/enum/message_type.h>
 
+#include <chrono>
 #include <filesystem>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "gui/sourced_message.h"
@@ -42,11 +44,26 @@ std::string FromWinWide(const std::wstring& wstr);
 
 std::vector<std::string> GetPreferredUILanguages();
 
-std::vector<std::filesystem::path> GetDriveRootPaths();
+// On Linux, mounts of pseudo, loop and remote filesystems are skipped unless
+// their type is in the given list, as games won't be installed on them and
+// accessing them may hang, spin up disks or trigger automounts. On Windows,
+// only fixed and RAM disk drives are returned.
+std::vector<std::filesystem::path> GetDriveRootPaths(
+    const std::vector<std::string>& allowedFilesystemTypes = {});
 
 std::optional<std::filesystem::path> FindXboxGamingRootPath(
     const std::filesystem::path& driveRootPath);
 
+// Probes the given drives concurrently, giving up on drives that take longer
+// than the timeout so that one unresponsive drive can't block startup. Any of
+// the previously found roots that are on a drive that was given up on are
+// assumed to still be valid. Probes of drives that were given up on are left
+// running in the background.
+std::vector<std::filesystem::path> FindXboxGamingRootPaths(
+    const std::vector<std::filesystem::path>& driveRootPaths,
+    std::chrono::milliseconds timeout,
+    const std::vector<std::filesystem::path>& previousRootPaths);
+
 // Compare strings as if they're filenames, respecting filesystem case
 // insensitivity on Windows. Returns -1 if lhs < rhs, 0 if lhs == rhs, and 1 if
 // lhs > rhs. The comparison may give different results on Linux, but is still
@@ -0,0 +1,147 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/interned_string.h"
+
+namespace {
+const std::shared_ptr<const std::string>& GetEmptyString() {
+  static const auto EMPTY_STRING = std::make_shared<const std::string>();
+
+  return EMPTY_STRING;
+}
+}
+
+namespace loot {
+InternedString::InternedString() : value_(GetEmptyString()) {}
+
+InternedString::InternedString(const char* value) :
+    InternedString(std::string(value)) {}
+
+InternedString::InternedString(std::string value) :
+    value_(value.empty()
+               ? GetEmptyString()
+               : std::make_shared<const std::string>(std::move(value))) {}
+
+InternedString::InternedString(std::shared_ptr<const std::string> value) :
+    value_(std::move(value)) {}
+
+const std::string& InternedString::str() const { return *value_; }
+
+bool InternedString::empty() const { return value_->empty(); }
+
+InternedString::operator const std::string&() const { return *value_; }
+
+bool operator==(const InternedString& lhs, const InternedString& rhs) {
+  return lhs.value_ == rhs.value_ || *lhs.value_ == *rhs.value_;
+}
+
+bool operator!=(const InternedString& lhs, const InternedString& rhs) {
+  return !(lhs == rhs);
+}
+
+bool operator==(const InternedString& lhs, const std::string& rhs) {
+  return lhs.str() == rhs;
+}
+
+bool operator!=(const InternedString& lhs, const std::string& rhs) {
+  return !(lhs == rhs);
+}
+
+bool operator==(const std::string& lhs, const InternedString& rhs) {
+  return rhs == lhs;
+}
+
+bool operator!=(const std::string& lhs, const InternedString& rhs) {
+  return !(rhs == lhs);
+}
+
+bool operator==(const InternedString& lhs, const char* rhs) {
+  return lhs.str() == rhs;
+}
+
+bool operator!=(const InternedString& lhs, const char* rhs) {
+  return !(lhs == rhs);
+}
+
+bool operator==(const char* lhs, const InternedString& rhs) {
+  return rhs == lhs;
+}
+
+bool operator!=(const char* lhs, const InternedString& rhs) {
+  return !(rhs == lhs);
+}
+
+std::ostream& operator<<(std::ostream& stream, const InternedString& string) {
+  return stream << string.str();
+}
+
+InternedString StringPool::Intern(std::string_view value) {
+  return Intern(value, nullptr);
+}
+
+InternedString StringPool::InternOwned(const InternedString& value) {
+  return Intern(value.str(), value.value_);
+}
+
+size_t StringPool::Size() const {
+  size_t size = 0;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    size += shard.strings.size();
+  }
+
+  return size;
+}
+
+void StringPool::Clear() {
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.strings.clear();
+  }
+}
+
+InternedString StringPool::Intern(
+    std::string_view value,
+    const std::shared_ptr<const std::string>& storage) {
+  if (value.empty()) {
+    return InternedString();
+  }
+
+  auto& shard =
+      shards_[std::hash<std::string_view>()(value) % shards_.size()];
+
+  std::lock_guard<std::mutex> guard(shard.mutex);
+
+  const auto it = shard.strings.find(value);
+  if (it != shard.strings.end()) {
+    return InternedString(it->second);
+  }
+
+  auto string = storage ? storage : std::make_shared<const std::string>(value);
+  shard.strings.emplace(std::string_view(*string), string);
+
+  return InternedString(std::move(string));
+}
+}
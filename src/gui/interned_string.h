@@ -0,0 +1,109 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_INTERNED_STRING
+#define LOOT_GUI_INTERNED_STRING
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace loot {
+// An immutable string that shares its storage with every other copy of it,
+// so copying one is as cheap as copying a pointer. Strings created through
+// the same StringPool also share storage if they have equal values.
+class InternedString {
+public:
+  InternedString();
+  InternedString(const char* value);
+  InternedString(std::string value);
+
+  const std::string& str() const;
+  bool empty() const;
+
+  operator const std::string&() const;
+
+private:
+  friend class StringPool;
+  friend bool operator==(const InternedString& lhs, const InternedString& rhs);
+
+  explicit InternedString(std::shared_ptr<const std::string> value);
+
+  std::shared_ptr<const std::string> value_;
+};
+
+bool operator==(const InternedString& lhs, const InternedString& rhs);
+bool operator!=(const InternedString& lhs, const InternedString& rhs);
+
+bool operator==(const InternedString& lhs, const std::string& rhs);
+bool operator!=(const InternedString& lhs, const std::string& rhs);
+bool operator==(const std::string& lhs, const InternedString& rhs);
+bool operator!=(const std::string& lhs, const InternedString& rhs);
+
+bool operator==(const InternedString& lhs, const char* rhs);
+bool operator!=(const InternedString& lhs, const char* rhs);
+bool operator==(const char* lhs, const InternedString& rhs);
+bool operator!=(const char* lhs, const InternedString& rhs);
+
+std::ostream& operator<<(std::ostream& stream, const InternedString& string);
+
+// A thread-safe set of unique strings. Strings stay in the pool until it is
+// cleared or destroyed, but InternedString objects created from the pool
+// keep their values alive independently.
+class StringPool {
+public:
+  InternedString Intern(std::string_view value);
+  // Like Intern(), but if the pool has no equal string it stores the given
+  // string's value instead of a copy of it.
+  InternedString InternOwned(const InternedString& value);
+
+  size_t Size() const;
+  void Clear();
+
+private:
+  // Strings are interned by many threads at once when plugin items are built
+  // in parallel, so the pool is split into shards that are locked separately.
+  static constexpr size_t SHARD_COUNT = 16;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    // The keys are views of the strings that the values point to.
+    std::unordered_map<std::string_view, std::shared_ptr<const std::string>>
+        strings;
+  };
+
+  // If storage is null and the value isn't in the pool, a copy is stored.
+  InternedString Intern(std::string_view value,
+                        const std::shared_ptr<const std::string>& storage);
+
+  std::array<Shard, SHARD_COUNT> shards_;
+};
+}
+
+#endif
@@ -0,0 +1,177 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/message_templates.h"
+
+#include <boost/locale.hpp>
+#include <stdexcept>
+
+namespace loot {
+namespace {
+std::string Translate(MessageTemplateId id, const std::locale& locale) {
+  using boost::locale::translate;
+
+  switch (id) {
+    case MessageTemplateId::conditionEvaluationFailed:
+      return translate(
+                 "\"{0}\" contains a condition that could not be evaluated. "
+                 "Details: {1}")
+          .str(locale);
+    case MessageTemplateId::unsortedLoadOrder:
+      return translate("You have not sorted your load order this session.")
+          .str(locale);
+    case MessageTemplateId::missingFile:
+      return translate(
+                 "This plugin requires \"{0}\" to be installed, but it is "
+                 "missing.")
+          .str(locale);
+    case MessageTemplateId::inactiveMaster:
+      return translate(
+                 "This plugin requires \"{0}\" to be active, but it is "
+                 "inactive.")
+          .str(locale);
+    case MessageTemplateId::incompatibleFile:
+      return translate(
+                 "This plugin is incompatible with \"{0}\", but both are "
+                 "present.")
+          .str(locale);
+    case MessageTemplateId::lightMasterRequiresNonMaster:
+      return translate(
+                 "This plugin is a light master and requires the non-master "
+                 "plugin \"{0}\". This can cause issues in-game, and sorting "
+                 "will fail while this plugin is installed.")
+          .str(locale);
+    case MessageTemplateId::invalidLightPlugin:
+      return translate(
+                 "This plugin contains records that have FormIDs outside the "
+                 "valid range for an ESL plugin. Using this plugin will cause "
+                 "irreversible damage to your game saves.")
+          .str(locale);
+    case MessageTemplateId::invalidHeaderVersion:
+      return translate(
+                 /* translators: A header is the part of a file that stores
+                    data like file name and version. */
+                 "This plugin has a header version of {0}, which is less than "
+                 "the game's minimum supported header version of {1}.")
+          .str(locale);
+    case MessageTemplateId::missingGroup:
+      return translate(
+                 "This plugin belongs to the group \"{0}\", which does not "
+                 "exist.")
+          .str(locale);
+    case MessageTemplateId::bashTagsOverride:
+      return translate(
+                 "This plugin has a BashTags file that will override the "
+                 "suggestions made by LOOT for the following Bash Tags: {0}.")
+          .str(locale);
+    case MessageTemplateId::location:
+      return translate("Location").str(locale);
+    case MessageTemplateId::numberedLocation:
+      return translate("Location {0}").str(locale);
+    case MessageTemplateId::cleaningFoundThree:
+      return translate("{0} found {1}, {2} and {3}.").str(locale);
+    case MessageTemplateId::cleaningFoundTwo:
+      return translate("{0} found {1} and {2}.").str(locale);
+    case MessageTemplateId::cleaningFoundOne:
+      return translate("{0} found {1}.").str(locale);
+    case MessageTemplateId::cleaningFoundDirtyEdits:
+      return translate("{0} found dirty edits.").str(locale);
+    default:
+      throw std::logic_error("Unrecognised message template ID");
+  }
+}
+
+std::string Translate(PluralMessageTemplateId id,
+                      unsigned int count,
+                      const std::locale& locale) {
+  using boost::locale::translate;
+
+  const auto n = static_cast<int>(count);
+
+  switch (id) {
+    case PluralMessageTemplateId::itmRecords:
+      return translate("{0} ITM record", "{0} ITM records", n).str(locale);
+    case PluralMessageTemplateId::deletedReferences:
+      return translate("{0} deleted reference", "{0} deleted references", n)
+          .str(locale);
+    case PluralMessageTemplateId::deletedNavmeshes:
+      return translate("{0} deleted navmesh", "{0} deleted navmeshes", n)
+          .str(locale);
+    default:
+      throw std::logic_error("Unrecognised plural message template ID");
+  }
+}
+
+MessageTemplates& GetSharedMessageTemplates() {
+  static MessageTemplates templates{std::locale()};
+  return templates;
+}
+}
+
+MessageTemplates::MessageTemplates(const std::locale& locale) :
+    locale_(locale) {
+  for (size_t i = 0; i < templates_.size(); i += 1) {
+    templates_[i] = Translate(static_cast<MessageTemplateId>(i), locale_);
+  }
+
+  for (size_t i = 0; i < pluralTemplates_.size(); i += 1) {
+    const auto id = static_cast<PluralMessageTemplateId>(i);
+    auto& translations = pluralTemplates_[i];
+
+    translations.reserve(PRE_TRANSLATED_PLURAL_COUNTS);
+    for (unsigned int count = 0; count < PRE_TRANSLATED_PLURAL_COUNTS;
+         count += 1) {
+      translations.push_back(Translate(id, count, locale_));
+    }
+  }
+}
+
+const std::string& MessageTemplates::Get(MessageTemplateId id) const {
+  return templates_.at(static_cast<size_t>(id));
+}
+
+std::string MessageTemplates::Get(PluralMessageTemplateId id,
+                                  unsigned int count) const {
+  const auto& translations = pluralTemplates_.at(static_cast<size_t>(id));
+  if (count < translations.size()) {
+    return translations[count];
+  }
+
+  return Translate(id, count, locale_);
+}
+
+void UpdateMessageTemplates() {
+  GetSharedMessageTemplates() = MessageTemplates(std::locale());
+}
+
+const std::string& GetMessageTemplate(MessageTemplateId id) {
+  return GetSharedMessageTemplates().Get(id);
+}
+
+std::string GetMessageTemplate(PluralMessageTemplateId id,
+                               unsigned int count) {
+  return GetSharedMessageTemplates().Get(id, count);
+}
+}
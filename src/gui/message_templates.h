@@ -0,0 +1,93 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_MESSAGE_TEMPLATES
+#define LOOT_GUI_MESSAGE_TEMPLATES
+
+#include <array>
+#include <locale>
+#include <string>
+#include <vector>
+
+namespace loot {
+enum struct MessageTemplateId : unsigned int {
+  conditionEvaluationFailed,
+  unsortedLoadOrder,
+  missingFile,
+  inactiveMaster,
+  incompatibleFile,
+  lightMasterRequiresNonMaster,
+  invalidLightPlugin,
+  invalidHeaderVersion,
+  missingGroup,
+  bashTagsOverride,
+  location,
+  numberedLocation,
+  cleaningFoundThree,
+  cleaningFoundTwo,
+  cleaningFoundOne,
+  cleaningFoundDirtyEdits
+};
+
+enum struct PluralMessageTemplateId : unsigned int {
+  itmRecords,
+  deletedReferences,
+  deletedNavmeshes
+};
+
+// Message text that is generated for many plugins at once is translated once
+// per language up front, as going through the message catalog each time is
+// relatively slow.
+class MessageTemplates {
+public:
+  explicit MessageTemplates(const std::locale& locale);
+
+  const std::string& Get(MessageTemplateId id) const;
+  // Only small counts are translated up front, larger counts are translated
+  // on demand.
+  std::string Get(PluralMessageTemplateId id, unsigned int count) const;
+
+private:
+  static constexpr size_t TEMPLATE_COUNT =
+      static_cast<size_t>(MessageTemplateId::cleaningFoundDirtyEdits) + 1;
+  static constexpr size_t PLURAL_TEMPLATE_COUNT =
+      static_cast<size_t>(PluralMessageTemplateId::deletedNavmeshes) + 1;
+  static constexpr unsigned int PRE_TRANSLATED_PLURAL_COUNTS = 100;
+
+  std::locale locale_;
+  std::array<std::string, TEMPLATE_COUNT> templates_;
+  std::array<std::vector<std::string>, PLURAL_TEMPLATE_COUNT> pluralTemplates_;
+};
+
+// Retranslates the shared templates using the current global locale. This
+// must be called after the global locale is changed, before any templates are
+// used.
+void UpdateMessageTemplates();
+
+const std::string& GetMessageTemplate(MessageTemplateId id);
+std::string GetMessageTemplate(PluralMessageTemplateId id, unsigned int count);
+}
+
+#endif
@@ -28,10 +28,10 @@
 #include <spdlog/fmt/fmt.h>
 
 #include <boost/algorithm/string.hpp>
-#include <boost/locale.hpp>
 #include <variant>
 
 #include "gui/helpers.h"
+#include "gui/message_templates.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 
@@ -54,12 +54,10 @@ evaluateMasterlistMetadata(const gui::Game& game,
     return CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::caughtException,
-        fmt::format(boost::locale::translate(
-                        "\"{0}\" contains a condition that could not be "
-                        "evaluated. Details: {1}")
-                        .str(),
-                    pluginName,
-                    e.what()));
+        fmt::format(
+            GetMessageTemplate(MessageTemplateId::conditionEvaluationFailed),
+            pluginName,
+            e.what()));
   }
 }
 
@@ -80,12 +78,10 @@ evaluateUserlistMetadata(const gui::Game& game, const std::string& pluginName) {
     return CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::caughtException,
-        fmt::format(boost::locale::translate(
-                        "\"{0}\" contains a condition that could not be "
-                        "evaluated. Details: {1}")
-                        .str(),
-                    pluginName,
-                    e.what()));
+        fmt::format(
+            GetMessageTemplate(MessageTemplateId::conditionEvaluationFailed),
+            pluginName,
+            e.what()));
   }
 }
 
@@ -123,6 +119,18 @@ std::pair<PluginMetadata, std::vector<SourcedMessage>> evaluateMetadata(
   return {metadata, evalErrors};
 }
 
+std::string joinTags(const std::vector<InternedString>& tags) {
+  std::string text;
+  for (const auto& tag : tags) {
+    if (&tag != &tags.front()) {
+      text += ", ";
+    }
+    text += tag.str();
+  }
+
+  return text;
+}
+
 PluginItem::PluginItem(const PluginInterface& plugin,
                        const gui::Game& game,
                        const std::optional<short>& loadOrderIndex,
@@ -137,7 +145,8 @@ PluginItem::PluginItem(const PluginInterface& plugin,
     isMaster(plugin.IsMaster()),
     isLightPlugin(plugin.IsLightPlugin()),
     loadsArchive(plugin.LoadsArchive()),
-    isCreationClubPlugin(game.IsCreationClubPlugin(plugin)) {
+    isCreationClubPlugin(game.IsCreationClubPlugin(plugin)),
+    isOfficialPlugin(IsOfficialPlugin(game.GetSettings().Id(), name)) {
   auto userMetadata = game.GetUserMetadata(plugin.GetName());
   if (userMetadata.has_value()) {
     hasUserMetadata =
@@ -148,7 +157,10 @@ PluginItem::PluginItem(const PluginInterface& plugin,
       evaluateMetadata(game, plugin.GetName());
 
   isDirty = !evaluatedMetadata.GetDirtyInfo().empty();
-  group = evaluatedMetadata.GetGroup();
+  const auto evaluatedGroup = evaluatedMetadata.GetGroup();
+  if (evaluatedGroup.has_value()) {
+    group = game.InternString(evaluatedGroup.value());
+  }
 
   messages.insert(messages.end(), evalErrors.begin(), evalErrors.end());
 
@@ -164,20 +176,28 @@ PluginItem::PluginItem(const PluginInterface& plugin,
   messages.insert(
       messages.end(), validityMessages.begin(), validityMessages.end());
 
+  // Many plugins share the same messages, tags and cleaning utilities, so
+  // intern their strings to avoid storing duplicates for every plugin. The
+  // message texts have already been built, so reuse them instead of copying
+  // them into the pool.
+  for (auto& message : messages) {
+    message.text = game.InternOwnedString(message.text);
+  }
+
   if (!evaluatedMetadata.GetCleanInfo().empty()) {
-    cleaningUtility =
-        evaluatedMetadata.GetCleanInfo().begin()->GetCleaningUtility();
+    cleaningUtility = game.InternString(
+        evaluatedMetadata.GetCleanInfo().begin()->GetCleaningUtility());
   }
 
   for (const auto& tag : plugin.GetBashTags()) {
-    currentTags.push_back(tag.GetName());
+    currentTags.push_back(game.InternString(tag.GetName()));
   }
 
   for (const auto& tag : evaluatedMetadata.GetTags()) {
     if (tag.IsAddition()) {
-      addTags.push_back(tag.GetName());
+      addTags.push_back(game.InternString(tag.GetName()));
     } else {
-      removeTags.push_back(tag.GetName());
+      removeTags.push_back(game.InternString(tag.GetName()));
     }
   }
 
@@ -187,12 +207,13 @@ PluginItem::PluginItem(const PluginInterface& plugin,
   // don't appear in the UI.
   if (locations.size() == 1 && locations[0].GetName().empty()) {
     locations[0] =
-        Location(locations[0].GetURL(), boost::locale::translate("Location"));
+        Location(locations[0].GetURL(),
+                 GetMessageTemplate(MessageTemplateId::location));
   } else if (locations.size() > 1) {
     for (size_t i = 0; i < locations.size(); i += 1) {
       if (locations[i].GetName().empty()) {
-        const auto locationName =
-            fmt::format(boost::locale::translate("Location {0}").str(), i + 1);
+        const auto locationName = fmt::format(
+            GetMessageTemplate(MessageTemplateId::numberedLocation), i + 1);
         locations[i] = Location(locations[i].GetURL(), locationName);
       }
     }
@@ -216,25 +237,25 @@ bool PluginItem::containsText(const std::string& text) const {
   }
 
   for (const auto& tag : currentTags) {
-    if (boost::icontains(tag, text)) {
+    if (boost::icontains(tag.str(), text)) {
       return true;
     }
   }
 
   for (const auto& tag : addTags) {
-    if (boost::icontains(tag, text)) {
+    if (boost::icontains(tag.str(), text)) {
       return true;
     }
   }
 
   for (const auto& tag : removeTags) {
-    if (boost::icontains(tag, text)) {
+    if (boost::icontains(tag.str(), text)) {
       return true;
     }
   }
 
   for (const auto& message : messages) {
-    if (boost::icontains(message.text, text)) {
+    if (boost::icontains(message.text.str(), text)) {
       return true;
     }
   }
@@ -265,25 +286,25 @@ bool PluginItem::containsMatchingText(const std::regex& regex) const {
   }
 
   for (const auto& tag : currentTags) {
-    if (std::regex_search(tag, regex)) {
+    if (std::regex_search(tag.str(), regex)) {
       return true;
     }
   }
 
   for (const auto& tag : addTags) {
-    if (std::regex_search(tag, regex)) {
+    if (std::regex_search(tag.str(), regex)) {
       return true;
     }
   }
 
   for (const auto& tag : removeTags) {
-    if (std::regex_search(tag, regex)) {
+    if (std::regex_search(tag.str(), regex)) {
       return true;
     }
   }
 
   for (const auto& message : messages) {
-    if (std::regex_search(message.text, regex)) {
+    if (std::regex_search(message.text.str(), regex)) {
       return true;
     }
   }
@@ -309,19 +330,19 @@ std::string PluginItem::contentToSearch() const {
   }
 
   for (const auto& tag : currentTags) {
-    text += tag;
+    text += tag.str();
   }
 
   for (const auto& tag : addTags) {
-    text += tag;
+    text += tag.str();
   }
 
   for (const auto& tag : removeTags) {
-    text += tag;
+    text += tag.str();
   }
 
   for (const auto& message : messages) {
-    text += message.text;
+    text += message.text.str();
   }
 
   for (const auto& location : locations) {
@@ -385,23 +406,23 @@ std::string PluginItem::getMarkdownContent() const {
   }
 
   if (cleaningUtility.has_value()) {
-    content += "- Verified clean by: " + cleaningUtility.value() + "\n";
+    content += "- Verified clean by: " + cleaningUtility.value().str() + "\n";
   }
 
   if (group.has_value()) {
-    content += "- Group: " + group.value() + "\n";
+    content += "- Group: " + group.value().str() + "\n";
   }
 
   if (!currentTags.empty()) {
-    content += "- Current Bash Tags: " + boost::join(currentTags, ", ") + "\n";
+    content += "- Current Bash Tags: " + joinTags(currentTags) + "\n";
   }
 
   if (!addTags.empty()) {
-    content += "- Add Bash Tags: " + boost::join(addTags, ", ") + "\n";
+    content += "- Add Bash Tags: " + joinTags(addTags) + "\n";
   }
 
   if (!removeTags.empty()) {
-    content += "- Remove Bash Tags: " + boost::join(removeTags, ", ") + "\n";
+    content += "- Remove Bash Tags: " + joinTags(removeTags) + "\n";
   }
 
   if (!messages.empty()) {
@@ -431,6 +452,26 @@ std::string PluginItem::loadOrderIndexText() const {
   }
 }
 
+bool operator==(const PluginItem& lhs, const PluginItem& rhs) {
+  return lhs.name == rhs.name && lhs.loadOrderIndex == rhs.loadOrderIndex &&
+         lhs.crc == rhs.crc && lhs.version == rhs.version &&
+         lhs.group == rhs.group && lhs.cleaningUtility == rhs.cleaningUtility &&
+         lhs.isActive == rhs.isActive && lhs.isDirty == rhs.isDirty &&
+         lhs.isEmpty == rhs.isEmpty && lhs.isMaster == rhs.isMaster &&
+         lhs.isLightPlugin == rhs.isLightPlugin &&
+         lhs.loadsArchive == rhs.loadsArchive &&
+         lhs.hasUserMetadata == rhs.hasUserMetadata &&
+         lhs.isCreationClubPlugin == rhs.isCreationClubPlugin &&
+         lhs.isOfficialPlugin == rhs.isOfficialPlugin &&
+         lhs.currentTags == rhs.currentTags && lhs.addTags == rhs.addTags &&
+         lhs.removeTags == rhs.removeTags && lhs.messages == rhs.messages &&
+         lhs.locations == rhs.locations;
+}
+
+bool operator!=(const PluginItem& lhs, const PluginItem& rhs) {
+  return !(lhs == rhs);
+}
+
 std::vector<PluginItem> GetPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
@@ -33,6 +33,7 @@
 #include <regex>
 #include <string>
 
+#include "gui/interned_string.h"
 #include "gui/sourced_message.h"
 #include "gui/state/game/game.h"
 
@@ -49,8 +50,8 @@ struct PluginItem {
   std::optional<short> loadOrderIndex;
   std::optional<uint32_t> crc;
   std::optional<std::string> version;
-  std::optional<std::string> group;
-  std::optional<std::string> cleaningUtility;
+  std::optional<InternedString> group;
+  std::optional<InternedString> cleaningUtility;
 
   bool isActive{false};
   bool isDirty{false};
@@ -60,10 +61,11 @@ struct PluginItem {
   bool loadsArchive{false};
   bool hasUserMetadata{false};
   bool isCreationClubPlugin{false};
+  bool isOfficialPlugin{false};
 
-  std::vector<std::string> currentTags;
-  std::vector<std::string> addTags;
-  std::vector<std::string> removeTags;
+  std::vector<InternedString> currentTags;
+  std::vector<InternedString> addTags;
+  std::vector<InternedString> removeTags;
 
   std::vector<SourcedMessage> messages;
   std::vector<Location> locations;
@@ -81,6 +83,10 @@ struct PluginItem {
   std::string loadOrderIndexText() const;
 };
 
+bool operator==(const PluginItem& lhs, const PluginItem& rhs);
+
+bool operator!=(const PluginItem& lhs, const PluginItem& rhs);
+
 std::vector<PluginItem> GetPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
@@ -34,7 +34,7 @@ std::vector<std::string> getMessageTexts(
     const std::vector<SourcedMessage>& messages) {
   std::vector<std::string> texts;
   for (const auto& message : messages) {
-    texts.push_back(message.text);
+    texts.push_back(message.text.str());
   }
 
   return texts;
@@ -56,61 +56,8 @@ std::vector<std::string> getLocationNames(
   return names;
 }
 
-QString getLongestString(std::initializer_list<std::string> list) {
-  if (list.size() == 0) {
-    return QString();
-  }
-
-  const std::string* longestString = list.begin();
-  size_t longestStringLength = 0;
-
-  for (auto& string : list) {
-    const auto length = string.size();
-    if (longestStringLength < length) {
-      longestString = &string;
-      longestStringLength = length;
-    }
-  }
-
-  return QString::fromStdString(*longestString);
-}
-
-SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
-  if (index.row() == 0) {
-    auto generalInfo = index.data(RawDataRole).value<GeneralInformation>();
-    auto counters =
-        index.data(CountersRole).value<GeneralInformationCounters>();
-
-    const auto secondColumnString =
-        getLongestString({generalInfo.masterlistRevision.id,
-                          generalInfo.masterlistRevision.date,
-                          generalInfo.preludeRevision.id,
-                          generalInfo.preludeRevision.date});
-    const auto fourthColumnString = QString::number(counters.totalMessages);
-    const auto sixthColumnString = QString::number(counters.totalPlugins);
-
-    const auto supportsLightPlugins =
-        generalInfo.gameSupportsLightPlugins ? "true" : "false";
-
-    return SizeHintCacheKey(secondColumnString,
-                            fourthColumnString,
-                            sixthColumnString,
-                            getMessageTexts(generalInfo.generalMessages),
-                            {supportsLightPlugins},
-                            true);
-  } else {
-    auto pluginItem = index.data(RawDataRole).value<PluginItem>();
-    auto filters =
-        index.data(CardContentFiltersRole).value<CardContentFiltersState>();
-
-    return SizeHintCacheKey(
-        getTagsText(pluginItem.currentTags, filters.hideBashTags),
-        getTagsText(pluginItem.addTags, filters.hideBashTags),
-        getTagsText(pluginItem.removeTags, filters.hideBashTags),
-        getMessageTexts(filterMessages(pluginItem, filters)),
-        getLocationNames(pluginItem.locations, filters.hideLocations),
-        false);
-  }
+CardFingerprint getCardFingerprint(const QModelIndex& index) {
+  return index.data(CardFingerprintRole).value<CardFingerprint>();
 }
 
 void prepareWidget(QWidget* widget) {
@@ -156,6 +103,17 @@ PluginCard* setPluginCardContent(PluginCard* card, const QModelIndex& index) {
 
 static std::map<QWidget*, int> minWidthByCard;
 
+// Text can only wrap onto more lines as its width decreases, so calculating
+// heights at the start of each bucket may leave a little space below a card's
+// content but never clips it.
+static constexpr int WIDTH_BUCKET_SIZE = 8;
+
+int getMinimumHeightForWidth(const QWidget* card, int width) {
+  return card->hasHeightForWidth()
+             ? card->layout()->minimumHeightForWidth(width)
+             : card->minimumHeight();
+}
+
 QSize calculateSize(const QWidget* card,
                     const QStyleOptionViewItem& option,
                     int largestMinCardWidth) {
@@ -199,16 +157,17 @@ QSize calculateSize(const QWidget* card,
 
   const auto widthForHeight = std::max(rectWidth, largestMinCardWidth);
 
-  const auto height =
-      card->hasHeightForWidth()
-          ? card->layout()->minimumHeightForWidth(widthForHeight)
-          : card->minimumHeight();
+  const auto height = getMinimumHeightForWidth(card, widthForHeight);
 
   return QSize(cardWidth, height);
 }
 
 CardSizingCache::CardSizingCache(QWidget* cardParentWidget) :
-    cardParentWidget(cardParentWidget) {}
+    generalInfoCard(new GeneralInfoCard(cardParentWidget)),
+    pluginCard(new PluginCard(cardParentWidget)) {
+  prepareWidget(generalInfoCard);
+  prepareWidget(pluginCard);
+}
 
 void CardSizingCache::update(const QAbstractItemModel* model) {
   update(model, 0, model->rowCount());
@@ -229,15 +188,114 @@ void CardSizingCache::update(const QAbstractItemModel* model,
   }
 }
 
-QWidget* CardSizingCache::update(const QModelIndex& index) {
+void CardSizingCache::update(const QModelIndex& index) { updateEntry(index); }
+
+void CardSizingCache::insertRows(int firstRow, int lastRow) {
+  shiftRows(firstRow, lastRow - firstRow + 1);
+}
+
+void CardSizingCache::removeRows(int firstRow, int lastRow) {
+  auto it = keyCache.lower_bound(firstRow);
+  while (it != keyCache.end() && it->first <= lastRow) {
+    const auto cardCacheIt = cardCache.find(*it->second);
+    if (cardCacheIt != cardCache.end()) {
+      cardCacheIt->second.count -= 1;
+
+      if (cardCacheIt->second.count == 0) {
+        cardCache.erase(cardCacheIt);
+      }
+    }
+
+    it = keyCache.erase(it);
+  }
+
+  shiftRows(lastRow + 1, firstRow - lastRow - 1);
+}
+
+void CardSizingCache::moveRows(int firstRow, int lastRow, int destinationRow) {
+  const auto count = lastRow - firstRow + 1;
+
+  std::vector<std::pair<int, const CardFingerprint*>> movedKeys;
+  auto it = keyCache.lower_bound(firstRow);
+  while (it != keyCache.end() && it->first <= lastRow) {
+    movedKeys.emplace_back(it->first - firstRow, it->second);
+    it = keyCache.erase(it);
+  }
+
+  // The destination row is the row that the moved rows are placed before,
+  // counted before they are moved.
+  const auto newFirstRow =
+      destinationRow > lastRow ? destinationRow - count : destinationRow;
+
+  shiftRows(lastRow + 1, -count);
+  shiftRows(newFirstRow, count);
+
+  for (const auto& [offset, key] : movedKeys) {
+    keyCache.emplace(newFirstRow + offset, key);
+  }
+}
+
+QSize CardSizingCache::getSize(const QModelIndex& index, int availableWidth) {
   if (!index.isValid()) {
-    return nullptr;
+    return QSize();
+  }
+
+  auto it = cardCache.find(getCardFingerprint(index));
+  if (it == cardCache.end()) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->warn(
+          "No cached card sizes exist for row {}, card sizes may not be "
+          "calculated correctly",
+          index.row());
+    }
+    it = updateEntry(index);
+  }
+
+  // See calculateSize() for an explanation of the widths involved.
+  auto& sizes = it->second;
+  const auto cardWidth = std::max(availableWidth, sizes.minWidth);
+  const auto widthForHeight = std::max(availableWidth, getLargestMinWidth());
+  const auto bucketWidth = widthForHeight - widthForHeight % WIDTH_BUCKET_SIZE;
+
+  auto heightIt = sizes.heightsByWidth.find(bucketWidth);
+  if (heightIt == sizes.heightsByWidth.end()) {
+    const auto height = estimateHeight(index, bucketWidth);
+    heightIt = sizes.heightsByWidth.emplace(bucketWidth, height).first;
+  }
+
+  return QSize(cardWidth, heightIt->second);
+}
+
+int CardSizingCache::getLargestMinWidth() const {
+  int largest = 0;
+  for (const auto& [key, sizes] : cardCache) {
+    if (sizes.minWidth > largest) {
+      largest = sizes.minWidth;
+    }
+  }
+
+  return largest;
+}
+
+void CardSizingCache::clearHeights() {
+  for (auto& [key, sizes] : cardCache) {
+    sizes.heightsByWidth.clear();
+  }
+}
+
+std::unordered_map<CardFingerprint,
+                   CardSizingCache::CardSizes,
+                   CardFingerprintHash>::iterator
+CardSizingCache::updateEntry(const QModelIndex& index) {
+  if (!index.isValid()) {
+    return cardCache.end();
   }
 
   // Get the key cache entry if it exists, and the new cache key and its
   // entry.
   const auto keyCacheIt = keyCache.find(index.row());
-  const auto newCacheKey = getSizeHintCacheKey(index);
+  const auto newCacheKey = getCardFingerprint(index);
   auto newCardCacheIt = cardCache.find(newCacheKey);
 
   if (keyCacheIt != keyCache.end()) {
@@ -245,43 +303,41 @@ QWidget* CardSizingCache::update(const QModelIndex& index) {
     const auto oldCacheKey = keyCacheIt->second;
     if (*oldCacheKey == newCacheKey) {
       // The cache key hasn't changed, no need to make any changes.
-      // Just return the key's card. It should never be null but handle that
-      // for safety.
-      return newCardCacheIt == cardCache.end() ? nullptr
-                                               : newCardCacheIt->second.first;
+      return newCardCacheIt;
     } else {
       // The cache key has changed, get the old key's card cache entry and
       // reduce its count by 1.
       const auto oldCardCacheIt = cardCache.find(*oldCacheKey);
       if (oldCardCacheIt != cardCache.end()) {
-        oldCardCacheIt->second.second -= 1;
+        oldCardCacheIt->second.count -= 1;
 
         // If the old key's count is now 0, remove it from the card cache.
-        if (oldCardCacheIt->second.second == 0) {
+        if (oldCardCacheIt->second.count == 0) {
           cardCache.erase(oldCardCacheIt);
         }
       }
     }
   }
 
-  // If there is no entry for the new cache key, create one.
+  // If there is no entry for the new cache key, create one. Its heights are
+  // calculated when they're first needed.
   if (newCardCacheIt == cardCache.end()) {
-    QWidget* widget = nullptr;
+    CardSizes sizes;
     if (index.row() == 0) {
-      widget = setGeneralInfoCardContent(new GeneralInfoCard(cardParentWidget),
-                                         index);
+      setGeneralInfoCardContent(generalInfoCard, index);
+      sizes.minWidth = generalInfoCard->layout()->minimumSize().width();
     } else {
-      widget = setPluginCardContent(new PluginCard(cardParentWidget), index);
+      const auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+      const auto filters =
+          index.data(CardContentFiltersRole).value<CardContentFiltersState>();
+      sizes.minWidth = pluginCard->estimateMinimumWidth(pluginItem, filters);
     }
 
-    prepareWidget(widget);
-
-    newCardCacheIt =
-        cardCache.emplace(newCacheKey, std::make_pair(widget, 0)).first;
+    newCardCacheIt = cardCache.emplace(newCacheKey, std::move(sizes)).first;
   }
 
   // Increase the new cache key's usage count by 1.
-  newCardCacheIt->second.second += 1;
+  newCardCacheIt->second.count += 1;
 
   if (keyCacheIt == keyCache.end()) {
     // This row has no cached key, add a pointer to the new key.
@@ -291,29 +347,41 @@ QWidget* CardSizingCache::update(const QModelIndex& index) {
     keyCacheIt->second = &newCardCacheIt->first;
   }
 
-  // Return the new cache key entry's card.
-  return newCardCacheIt->second.first;
+  return newCardCacheIt;
 }
 
-QWidget* CardSizingCache::getCard(const SizeHintCacheKey& key) const {
-  auto it = cardCache.find(key);
-  if (it != cardCache.end()) {
-    return it->second.first;
+void CardSizingCache::shiftRows(int firstRow, int offset) {
+  // Shifting doesn't change the order of rows, so the shifted map can be
+  // built in order.
+  std::map<int, const CardFingerprint*> shiftedKeyCache;
+  for (const auto& [row, key] : keyCache) {
+    const auto shiftedRow = row >= firstRow ? row + offset : row;
+    shiftedKeyCache.emplace_hint(shiftedKeyCache.end(), shiftedRow, key);
   }
 
-  return nullptr;
+  keyCache = std::move(shiftedKeyCache);
 }
 
-int CardSizingCache::getLargestMinWidth() const {
-  int largest = 0;
-  for (const auto& [key, value] : cardCache) {
-    const auto minWidth = value.first->layout()->minimumSize().width();
-    if (minWidth > largest) {
-      largest = minWidth;
-    }
+int CardSizingCache::estimateHeight(const QModelIndex& index, int width) {
+  if (index.row() == 0) {
+    // There's only one general info card, so just measure it.
+    setGeneralInfoCardContent(generalInfoCard, index);
+    return getMinimumHeightForWidth(generalInfoCard, width);
   }
 
-  return largest;
+  // Heights are only estimated when a card's fingerprint is first seen at a
+  // given width, so it's fine to get the card's text content again.
+  const auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  const auto filters =
+      index.data(CardContentFiltersRole).value<CardContentFiltersState>();
+
+  return pluginCard->estimateHeightForWidth(
+      getTagsText(pluginItem.currentTags, filters.hideBashTags),
+      getTagsText(pluginItem.addTags, filters.hideBashTags),
+      getTagsText(pluginItem.removeTags, filters.hideBashTags),
+      getMessageTexts(filterMessages(pluginItem, filters)),
+      getLocationNames(pluginItem.locations, filters.hideLocations),
+      width);
 }
 
 CardDelegate::CardDelegate(QListView* parent,
@@ -331,6 +399,7 @@ void CardDelegate::setIcons() { pluginCard->setIcons(); }
 void CardDelegate::refreshMessages() {
   generalInfoCard->refreshMessages();
   pluginCard->refreshMessages();
+  cardSizingCache->clearHeights();
 }
 
 void CardDelegate::paint(QPainter* painter,
@@ -384,37 +453,7 @@ QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
     return QStyledItemDelegate::sizeHint(option, index);
   }
 
-  const auto cacheKey = getSizeHintCacheKey(index);
-
-  auto it = sizeHintCache.find(cacheKey);
-  if (it != sizeHintCache.end()) {
-    // Found a cached size, check if its width matches the current available
-    // width.
-    if (it->second.width() == styleOption.rect.width()) {
-      // The cached size is valid, return it.
-      return it->second;
-    }
-  } else {
-    // Store an invalid size so that it can be replaced below.
-    it = sizeHintCache.emplace(cacheKey, QSize()).first;
-  }
-
-  auto card = cardSizingCache->getCard(cacheKey);
-  if (card == nullptr) {
-    const auto logger = getLogger();
-    logger->warn(
-        "No cached card exists for row {}, card sizes may not be calculated "
-        "correctly",
-        index.row());
-    card = cardSizingCache->update(index);
-  }
-
-  const auto sizeHint =
-      calculateSize(card, styleOption, cardSizingCache->getLargestMinWidth());
-
-  it->second = sizeHint;
-
-  return sizeHint;
+  return cardSizingCache->getSize(index, styleOption.rect.width());
 }
 
 QWidget* CardDelegate::createEditor(QWidget* parent,
@@ -30,49 +30,24 @@
 #include <QtWidgets/QListView>
 #include <QtWidgets/QStyledItemDelegate>
 #include <QtWidgets/QWidget>
+#include <unordered_map>
 
+#include "gui/qt/card_fingerprint.h"
 #include "gui/qt/general_info_card.h"
 #include "gui/qt/plugin_card.h"
 #include "gui/qt/plugin_item_model.h"
 
 namespace loot {
-// SizeHintCacheKey contains all the data that the card size could depend on,
-// aside from the available width, and so it means that different plugins with
-// cards of the same size can share cached size data.
-//
-// In order of appearance, the tuple fields are:
-//
-//   General info card:
-//
-//   1. Longest text in second table column
-//   2. Longest text in fourth table column (total messages count)
-//   3. Longest text in sixth table column (total plugins count)
-//   4. Message texts
-//   5. Whether the game supports light plugins or not
-//   6. true
-//
-//   Plugin card:
-//
-//   1. Current bash tags
-//   2. Add bash tags
-//   3. Remove bash tags
-//   4. Message texts
-//   5. Location info
-//   6. false
-//
-typedef std::tuple<QString,
-                   QString,
-                   QString,
-                   std::vector<std::string>,
-                   std::vector<std::string>,
-                   bool>
-    SizeHintCacheKey;
-
 /**
  * Whenever the model's raw data changes, this cache needs to be updated for the
  * affected indexes. This update needs to happen before the delegate's paint or
  * size hint methods are called so that they are given the correct largest min
  * width value.
+ *
+ * Plugin card sizes are estimated from their text content using a single
+ * measuring card, so no widgets are created per cache key. Heights are cached
+ * per width bucket, so resizing the view only recalculates a height when the
+ * width moves into a new bucket.
  */
 class CardSizingCache {
 public:
@@ -81,16 +56,39 @@ public:
   void update(const QAbstractItemModel* model);
   void update(const QModelIndex& topLeft, const QModelIndex& bottomRight);
   void update(const QAbstractItemModel*, int firstRow, int lastRow);
-  QWidget* update(const QModelIndex& index);
+  void update(const QModelIndex& index);
+
+  // Keep cached keys associated with the right rows when rows are inserted,
+  // removed or moved. Inserted rows must then be updated.
+  void insertRows(int firstRow, int lastRow);
+  void removeRows(int firstRow, int lastRow);
+  void moveRows(int firstRow, int lastRow, int destinationRow);
 
-  QWidget* getCard(const SizeHintCacheKey& key) const;
+  QSize getSize(const QModelIndex& index, int availableWidth);
 
   int getLargestMinWidth() const;
 
+  // Discard cached heights, e.g. because the UI language has changed.
+  void clearHeights();
+
 private:
-  QWidget* cardParentWidget{nullptr};
-  std::map<int, const SizeHintCacheKey*> keyCache;
-  std::map<SizeHintCacheKey, std::pair<QWidget*, unsigned int>> cardCache;
+  struct CardSizes {
+    unsigned int count{0};
+    int minWidth{0};
+    std::map<int, int> heightsByWidth;
+  };
+
+  GeneralInfoCard* generalInfoCard{nullptr};
+  PluginCard* pluginCard{nullptr};
+  std::map<int, const CardFingerprint*> keyCache;
+  std::unordered_map<CardFingerprint, CardSizes, CardFingerprintHash>
+      cardCache;
+
+  std::unordered_map<CardFingerprint, CardSizes, CardFingerprintHash>::iterator
+  updateEntry(const QModelIndex& index);
+  void shiftRows(int firstRow, int offset);
+
+  int estimateHeight(const QModelIndex& index, int width);
 };
 
 class CardDelegate : public QStyledItemDelegate {
@@ -122,7 +120,6 @@ private:
   GeneralInfoCard* generalInfoCard{nullptr};
   PluginCard* pluginCard{nullptr};
   CardSizingCache* cardSizingCache;
-  mutable std::map<SizeHintCacheKey, QSize> sizeHintCache;
 };
 }
 
@@ -0,0 +1,157 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/card_fingerprint.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QtEndian>
+
+#include "gui/qt/plugin_card.h"
+
+namespace {
+using loot::CardFingerprint;
+using loot::InternedString;
+using loot::SourcedMessage;
+
+// Lengths are hashed before data so that the boundaries between fields are
+// unambiguous.
+class FingerprintBuilder {
+public:
+  void add(bool value) { add(static_cast<uint64_t>(value)); }
+
+  void add(uint64_t value) {
+    const auto littleEndianValue = qToLittleEndian(value);
+    hash_.addData(QByteArrayView(
+        reinterpret_cast<const char*>(&littleEndianValue),
+        sizeof(littleEndianValue)));
+  }
+
+  void add(const std::string& value) {
+    add(static_cast<uint64_t>(value.size()));
+    hash_.addData(QByteArrayView(value.data(), value.size()));
+  }
+
+  void add(const std::vector<InternedString>& values) {
+    add(static_cast<uint64_t>(values.size()));
+    for (const auto& value : values) {
+      add(value.str());
+    }
+  }
+
+  void add(const std::vector<SourcedMessage>& messages) {
+    add(static_cast<uint64_t>(messages.size()));
+    for (const auto& message : messages) {
+      add(message.text.str());
+    }
+  }
+
+  CardFingerprint result() const {
+    const auto digest = hash_.result();
+
+    CardFingerprint fingerprint;
+    fingerprint.high = qFromLittleEndian<uint64_t>(digest.constData());
+    fingerprint.low = qFromLittleEndian<uint64_t>(digest.constData() + 8);
+
+    return fingerprint;
+  }
+
+private:
+  QCryptographicHash hash_{QCryptographicHash::Md5};
+};
+
+const std::string& getLongestString(
+    std::initializer_list<const std::string*> list) {
+  static const std::string EMPTY_STRING;
+
+  const std::string* longestString = &EMPTY_STRING;
+  for (const auto string : list) {
+    if (longestString->size() < string->size()) {
+      longestString = string;
+    }
+  }
+
+  return *longestString;
+}
+}
+
+namespace loot {
+bool operator==(const CardFingerprint& lhs, const CardFingerprint& rhs) {
+  return lhs.high == rhs.high && lhs.low == rhs.low;
+}
+
+bool operator!=(const CardFingerprint& lhs, const CardFingerprint& rhs) {
+  return !(lhs == rhs);
+}
+
+size_t CardFingerprintHash::operator()(
+    const CardFingerprint& fingerprint) const {
+  // The fingerprint is already a hash, so just use part of it.
+  return static_cast<size_t>(fingerprint.low);
+}
+
+CardFingerprint getCardFingerprint(
+    const GeneralInformation& generalInfo,
+    const GeneralInformationCounters& counters) {
+  FingerprintBuilder builder;
+
+  builder.add(true);
+  builder.add(getLongestString({&generalInfo.masterlistRevision.id,
+                                &generalInfo.masterlistRevision.date,
+                                &generalInfo.preludeRevision.id,
+                                &generalInfo.preludeRevision.date}));
+  builder.add(std::to_string(counters.totalMessages));
+  builder.add(std::to_string(counters.totalPlugins));
+  builder.add(generalInfo.generalMessages);
+  builder.add(generalInfo.gameSupportsLightPlugins);
+
+  return builder.result();
+}
+
+CardFingerprint getCardFingerprint(const PluginItem& plugin,
+                                   const CardContentFiltersState& filters) {
+  static const std::vector<InternedString> NO_TAGS;
+
+  FingerprintBuilder builder;
+
+  builder.add(false);
+
+  builder.add(filters.hideBashTags ? NO_TAGS : plugin.currentTags);
+  builder.add(filters.hideBashTags ? NO_TAGS : plugin.addTags);
+  builder.add(filters.hideBashTags ? NO_TAGS : plugin.removeTags);
+
+  builder.add(filterMessages(plugin, filters));
+
+  if (filters.hideLocations) {
+    builder.add(uint64_t{0});
+  } else {
+    builder.add(static_cast<uint64_t>(plugin.locations.size()));
+    for (const auto& location : plugin.locations) {
+      builder.add(location.GetName());
+    }
+  }
+
+  return builder.result();
+}
+}
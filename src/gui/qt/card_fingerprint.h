@@ -0,0 +1,82 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_CARD_FINGERPRINT
+#define LOOT_GUI_QT_CARD_FINGERPRINT
+
+#include <QtCore/QMetaType>
+#include <cstdint>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/counters.h"
+#include "gui/qt/filters_states.h"
+#include "gui/qt/general_info.h"
+
+namespace loot {
+// A CardFingerprint is a 128-bit hash of all the data that a card's size
+// could depend on, aside from the available width, so that different cards
+// of the same size can share cached size data.
+//
+// For the general info card, that data is:
+//
+//   1. Longest text in second table column
+//   2. Longest text in fourth table column (total messages count)
+//   3. Longest text in sixth table column (total plugins count)
+//   4. Message texts
+//   5. Whether the game supports light plugins or not
+//
+// For plugin cards, it is:
+//
+//   1. Current bash tags
+//   2. Add bash tags
+//   3. Remove bash tags
+//   4. Message texts
+//   5. Location names
+//
+// The two types of card are hashed differently, so their fingerprints never
+// match.
+struct CardFingerprint {
+  uint64_t high{0};
+  uint64_t low{0};
+};
+
+bool operator==(const CardFingerprint& lhs, const CardFingerprint& rhs);
+bool operator!=(const CardFingerprint& lhs, const CardFingerprint& rhs);
+
+struct CardFingerprintHash {
+  size_t operator()(const CardFingerprint& fingerprint) const;
+};
+
+CardFingerprint getCardFingerprint(
+    const GeneralInformation& generalInfo,
+    const GeneralInformationCounters& counters);
+
+CardFingerprint getCardFingerprint(const PluginItem& plugin,
+                                   const CardContentFiltersState& filters);
+}
+
+Q_DECLARE_METATYPE(loot::CardFingerprint);
+
+#endif
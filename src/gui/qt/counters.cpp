@@ -25,8 +25,6 @@
 
 #include "gui/qt/counters.h"
 
-#include "gui/state/game/helpers.h"
-
 namespace loot {
 GeneralInformationCounters::GeneralInformationCounters(
     const std::vector<SourcedMessage>& generalMessages,
@@ -63,7 +61,7 @@ void GeneralInformationCounters::countMessages(
   totalMessages += messages.size();
 }
 
-bool shouldFilterMessage(const std::string& pluginName,
+bool shouldFilterMessage(const PluginItem& plugin,
                          const SourcedMessage& message,
                          const CardContentFiltersState& filters) {
   if (message.type == MessageType::say && filters.hideNotes) {
@@ -72,7 +70,7 @@ bool shouldFilterMessage(const std::string& pluginName,
 
   if (filters.hideOfficialPluginsCleaningMessages &&
       message.source == MessageSource::cleaningMetadata &&
-      IsOfficialPlugin(filters.gameId, pluginName)) {
+      plugin.isOfficialPlugin) {
     return true;
   }
 
@@ -93,7 +91,7 @@ size_t countHiddenMessages(const std::vector<PluginItem>& plugins,
                             plugin.messages.end(),
                             [&](const SourcedMessage& message) {
                               return shouldFilterMessage(
-                                  plugin.name, message, filters);
+                                  plugin, message, filters);
                             });
   }
 
@@ -49,7 +49,7 @@ private:
   void countMessages(const std::vector<SourcedMessage>& messages);
 };
 
-bool shouldFilterMessage(const std::string& pluginName,
+bool shouldFilterMessage(const PluginItem& plugin,
                          const SourcedMessage& message,
                          const CardContentFiltersState& filters);
 
@@ -32,8 +32,6 @@
 #include <string>
 #include <variant>
 
-#include "gui/state/game/detection/game_install.h"
-
 namespace loot {
 struct CardContentFiltersState {
   bool hideVersionNumbers{false};
@@ -43,8 +41,6 @@ struct CardContentFiltersState {
   bool hideNotes{false};
   bool hideOfficialPluginsCleaningMessages{false};
   bool hideAllPluginMessages{false};
-
-  GameId gameId{GameId::tes3};
 };
 
 struct PluginFiltersState {
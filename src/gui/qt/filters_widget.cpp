@@ -36,8 +36,6 @@
 namespace loot {
 FiltersWidget::FiltersWidget(QWidget* parent) : QFrame(parent) { setupUi(); }
 
-void FiltersWidget::setGameId(const GameId newGameId) { gameId = newGameId; }
-
 void FiltersWidget::setPlugins(const std::vector<std::string>& pluginNames) {
   setComboBoxItems(conflictingPluginsFilter, pluginNames);
 }
@@ -330,7 +328,6 @@ CardContentFiltersState FiltersWidget::getCardContentFiltersState() const {
   filters.hideOfficialPluginsCleaningMessages =
       officialPluginsCleaningMessagesFilter->isChecked();
   filters.hideAllPluginMessages = pluginMessagesFilter->isChecked();
-  filters.gameId = gameId;
 
   return filters;
 }
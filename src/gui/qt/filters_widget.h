@@ -42,7 +42,6 @@ class FiltersWidget : public QFrame {
 public:
   explicit FiltersWidget(QWidget *parent);
 
-  void setGameId(const GameId gameId);
   void setPlugins(const std::vector<std::string> &pluginNames);
   void setGroups(const std::vector<std::string> &groupNames);
 
@@ -88,7 +87,6 @@ private:
   QLabel *hiddenMessagesCountLabel{new QLabel(this)};
 
   LootSettings::Filters warningsAndErrorFilterMemory;
-  GameId gameId{GameId::tes3};
 
   void setupUi();
 
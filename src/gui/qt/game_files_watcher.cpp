@@ -0,0 +1,141 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/game_files_watcher.h"
+
+#include "gui/state/logging.h"
+
+namespace loot {
+GameFilesWatcher::GameFilesWatcher(QObject* parent) : QObject(parent) {
+  debounceTimer->setSingleShot(true);
+  debounceTimer->setInterval(DEBOUNCE_INTERVAL_MS);
+
+  connect(fileSystemWatcher,
+          &QFileSystemWatcher::directoryChanged,
+          this,
+          &GameFilesWatcher::onPathChanged);
+  connect(fileSystemWatcher,
+          &QFileSystemWatcher::fileChanged,
+          this,
+          &GameFilesWatcher::onPathChanged);
+  connect(debounceTimer,
+          &QTimer::timeout,
+          this,
+          &GameFilesWatcher::onDebounceTimeout);
+}
+
+void GameFilesWatcher::watch(const gui::Game& game) {
+  stop();
+
+  pluginsDirectoryPaths = game.GetPluginsDirectoryPaths();
+  loadOrderFilePaths = game.GetLoadOrderFilePaths();
+  snapshot = TakeGameFilesSnapshot(pluginsDirectoryPaths, loadOrderFilePaths);
+
+  updateWatchedPaths();
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->debug("Watching {} paths for changes to {}'s files",
+                  fileSystemWatcher->directories().size() +
+                      fileSystemWatcher->files().size(),
+                  game.GetSettings().Name());
+  }
+}
+
+void GameFilesWatcher::stop() {
+  debounceTimer->stop();
+
+  const auto watchedPaths =
+      fileSystemWatcher->directories() + fileSystemWatcher->files();
+  if (!watchedPaths.isEmpty()) {
+    fileSystemWatcher->removePaths(watchedPaths);
+  }
+
+  pluginsDirectoryPaths.clear();
+  loadOrderFilePaths.clear();
+  snapshot = GameFilesSnapshot();
+}
+
+bool GameFilesWatcher::isWatching() const {
+  return !pluginsDirectoryPaths.empty();
+}
+
+void GameFilesWatcher::updateWatchedPaths() {
+  // Watch the directories for added, removed and renamed files, and the load
+  // order files themselves because editing a file doesn't reliably change
+  // its directory on every platform. Paths that don't exist can't be
+  // watched, and editors and mod managers often replace files instead of
+  // writing to them, which removes the watch, so the paths are re-added
+  // after every change.
+  std::vector<std::filesystem::path> paths = pluginsDirectoryPaths;
+  if (!pluginsDirectoryPaths.empty()) {
+    paths.push_back(pluginsDirectoryPaths.back() / "BashTags");
+  }
+
+  for (const auto& filePath : loadOrderFilePaths) {
+    paths.push_back(filePath.parent_path());
+    paths.push_back(filePath);
+  }
+
+  const auto watchedPaths =
+      fileSystemWatcher->directories() + fileSystemWatcher->files();
+
+  QStringList pathsToAdd;
+  for (const auto& path : paths) {
+    const auto qPath = QString::fromStdString(path.u8string());
+    std::error_code errorCode;
+    if (!watchedPaths.contains(qPath) && !pathsToAdd.contains(qPath) &&
+        std::filesystem::exists(path, errorCode)) {
+      pathsToAdd.append(qPath);
+    }
+  }
+
+  if (!pathsToAdd.isEmpty()) {
+    fileSystemWatcher->addPaths(pathsToAdd);
+  }
+}
+
+void GameFilesWatcher::onPathChanged() {
+  // Restart the timer so that it only fires once changes have stopped.
+  debounceTimer->start();
+}
+
+void GameFilesWatcher::onDebounceTimeout() {
+  if (!isWatching()) {
+    return;
+  }
+
+  auto newSnapshot =
+      TakeGameFilesSnapshot(pluginsDirectoryPaths, loadOrderFilePaths);
+  const auto changes = GetGameFilesChanges(snapshot, newSnapshot);
+  snapshot = std::move(newSnapshot);
+
+  updateWatchedPaths();
+
+  if (!changes.IsEmpty()) {
+    emit changed(changes);
+  }
+}
+}
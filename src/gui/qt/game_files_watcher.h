@@ -0,0 +1,73 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GAME_FILES_WATCHER
+#define LOOT_GUI_QT_GAME_FILES_WATCHER
+
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <filesystem>
+#include <vector>
+
+#include "gui/state/game/game.h"
+#include "gui/state/game/game_files_snapshot.h"
+
+namespace loot {
+// Watches a game's plugin directories, BashTags directory and load order
+// files, and reports what changed once they have stopped changing for a short
+// while, so that a mod manager installing many files only causes one update.
+class GameFilesWatcher : public QObject {
+  Q_OBJECT
+public:
+  explicit GameFilesWatcher(QObject* parent);
+
+  void watch(const gui::Game& game);
+  void stop();
+
+  bool isWatching() const;
+
+signals:
+  void changed(const GameFilesChanges& changes);
+
+private:
+  static constexpr int DEBOUNCE_INTERVAL_MS = 500;
+
+  QFileSystemWatcher* fileSystemWatcher{new QFileSystemWatcher(this)};
+  QTimer* debounceTimer{new QTimer(this)};
+
+  std::vector<std::filesystem::path> pluginsDirectoryPaths;
+  std::vector<std::filesystem::path> loadOrderFilePaths;
+  GameFilesSnapshot snapshot;
+
+  void updateWatchedPaths();
+
+private slots:
+  void onPathChanged();
+  void onDebounceTimeout();
+};
+}
+
+#endif
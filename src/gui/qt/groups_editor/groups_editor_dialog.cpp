@@ -331,7 +331,7 @@ const std::string GroupsEditorDialog::getPluginGroup(
   auto newPluginGroupIt = newPluginGroups.find(pluginItem.name);
 
   return newPluginGroupIt == newPluginGroups.end()
-             ? pluginItem.group.value_or(Group::DEFAULT_NAME)
+             ? pluginItem.group.value_or(Group::DEFAULT_NAME).str()
              : newPluginGroupIt->second;
 }
 
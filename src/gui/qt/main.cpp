@@ -89,6 +89,10 @@ int main(int argc, char* argv[]) {
 
   loot::ApplicationMutexGuard mutexGuard;
 
+  // Declared before everything that logs so that it's destroyed after them,
+  // once the event loop has returned, and flushes their queued messages.
+  loot::LoggingShutdownGuard loggingShutdownGuard;
+
   QApplication app(argc, argv);
 
   QCommandLineParser parser;
@@ -38,6 +38,8 @@
 #include <QtWidgets/QScrollBar>
 #include <QtWidgets/QTextEdit>
 #include <boost/algorithm/string.hpp>
+#include <set>
+#include <unordered_set>
 
 #include "gui/backup.h"
 #include "gui/qt/helpers.h"
@@ -54,6 +56,7 @@
 #include "gui/query/types/clear_plugin_metadata_query.h"
 #include "gui/query/types/get_conflicting_plugins_query.h"
 #include "gui/query/types/get_game_data_query.h"
+#include "gui/query/types/refresh_changed_plugins_query.h"
 #include "gui/query/types/sort_plugins_query.h"
 #include "gui/version.h"
 
@@ -93,6 +96,24 @@ bool hasLoadOrderChanged(const std::vector<std::string>& oldLoadOrder,
   return false;
 }
 
+std::string getFileLink(const std::filesystem::path& path) {
+  const auto pathString = path.u8string();
+  return "<pre><a href=\"file:" + pathString +
+         "\" style=\"white-space: nowrap\">" + pathString + "</a></pre>";
+}
+
+// Incremental backups give the path to the backup's manifest instead of a zip
+// file.
+bool isIncrementalBackup(const std::filesystem::path& backupPath) {
+  return backupPath.extension() != ".zip";
+}
+
+bool isSearchTextEmpty(const QVariant& text) {
+  return (text.userType() == QMetaType::QString && text.toString().isEmpty()) ||
+         (text.userType() == QMetaType::QRegularExpression &&
+          text.toRegularExpression().pattern().isEmpty());
+}
+
 int calculateSidebarHeaderWidth(const QAbstractItemView& view, int column) {
   const auto headerText =
       view.model()->headerData(column, Qt::Horizontal).toString();
@@ -229,6 +250,14 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
 
   setupUi();
 
+  state.SetUserMetadataWriteErrorHandler([this](const std::string& error) {
+    // This is called from a userlist writer's thread.
+    QMetaObject::invokeMethod(
+        this,
+        [this, error]() { handleUserMetadataWriteError(error); },
+        Qt::QueuedConnection);
+  });
+
   auto installedGames = state.GetInstalledGameFolderNames();
 
   for (const auto& gameSettings : state.getSettings().getGameSettings()) {
@@ -269,7 +298,6 @@ void MainWindow::initialise() {
     }
 
     const auto& filters = state.getSettings().getFilters();
-    filtersWidget->setGameId(state.GetCurrentGame().GetSettings().Id());
     filtersWidget->setFilterStates(filters);
 
     // Apply the filters before loading the game because that avoids having
@@ -286,7 +314,7 @@ void MainWindow::initialise() {
     // Check for updates.
     if (state.getSettings().isLootUpdateCheckEnabled()) {
       // This task can be run in the main thread because it's non-blocking.
-      const auto task = new CheckForUpdateTask();
+      const auto task = new CheckForUpdateTask(*networkSession);
 
       connect(
           task, &Task::finished, this, &MainWindow::handleUpdateCheckFinished);
@@ -420,6 +448,16 @@ void MainWindow::setupUi() {
 
   groupsEditor->setObjectName("groupsEditor");
 
+  gameFilesWatcher->setObjectName("gameFilesWatcher");
+  prefetchPluginsTask->setObjectName("prefetchPluginsTask");
+
+  // Wait for typing to pause before searching.
+  static constexpr int SEARCH_DELAY_MS = 150;
+  searchTimer->setObjectName("searchTimer");
+  searchTimer->setSingleShot(true);
+  searchTimer->setInterval(SEARCH_DELAY_MS);
+  searchPluginsTask->setObjectName("searchPluginsTask");
+
   setupViews();
 
   translateUi();
@@ -823,6 +861,8 @@ void MainWindow::exitEditingState() {
 
   sidebarPluginsView->verticalHeader()->setDefaultSectionSize(
       getSidebarRowHeight(false));
+
+  refreshChangedGameFiles();
 }
 
 void MainWindow::enterSortingState() {
@@ -851,6 +891,8 @@ void MainWindow::exitSortingState() {
   gameComboBox->setDisabled(false);
   actionRefreshContent->setDisabled(false);
   actionCopyLoadOrder->setDisabled(false);
+
+  refreshChangedGameFiles();
 }
 
 void MainWindow::loadGame(bool isOnLOOTStartup) {
@@ -994,32 +1036,138 @@ void MainWindow::setFiltersState(
 }
 
 void MainWindow::refreshSearch() {
-  on_searchDialog_textChanged(searchDialog->getSearchText());
+  const auto text = searchDialog->getSearchText();
+
+  if (isSearchTextEmpty(text)) {
+    on_searchDialog_textChanged(text);
+  } else {
+    // Something other than the search text has changed, so don't wait.
+    searchTimer->stop();
+    searchPlugins(text);
+  }
 }
 
-void MainWindow::refreshPluginRawData(const std::string& pluginName) {
-  const auto loadOrder = state.GetCurrentGame().GetLoadOrder();
+void MainWindow::searchPlugins(const QVariant& text) {
+  // Only search the plugins that are visible, in the order they're shown.
+  const auto& pluginItems = pluginItemModel->getPluginItems();
 
-  for (int i = 1; i < pluginItemModel->rowCount(); i += 1) {
-    const auto index = pluginItemModel->index(i, 0);
-    const auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  std::vector<PluginItem> plugins;
+  plugins.reserve(proxyModel->rowCount());
+  for (int row = 1; row < proxyModel->rowCount(); row += 1) {
+    const auto sourceIndex = proxyModel->mapToSource(
+        proxyModel->index(row, PluginItemModel::CARDS_COLUMN));
 
-    if (pluginItem.name == pluginName) {
-      const auto& plugin = *state.GetCurrentGame().GetPlugin(pluginName);
-      const auto newPluginItem = PluginItem(
-          plugin,
-          state.GetCurrentGame(),
-          state.GetCurrentGame().GetActiveLoadOrderIndex(plugin, loadOrder),
-          state.GetCurrentGame().IsPluginActive(plugin.GetName()),
-          state.getSettings().getLanguage());
+    plugins.push_back(pluginItems.at(sourceIndex.row() - 1));
+  }
 
-      const auto indexData = QVariant::fromValue(newPluginItem);
-      pluginItemModel->setData(index, indexData, RawDataRole);
-      break;
-    }
+  searchPluginsTask->start(text, std::move(plugins));
+}
+
+void MainWindow::refreshPluginRawData(
+    const std::vector<std::string>& pluginNames) {
+  if (pluginNames.empty()) {
+    return;
+  }
+
+  const auto& game = state.GetCurrentGame();
+  const auto language = state.getSettings().getLanguage();
+
+  // Load order entries may not have the same case as the given names.
+  std::set<Filename> pluginsToRefresh;
+  for (const auto& pluginName : pluginNames) {
+    pluginsToRefresh.insert(Filename(pluginName));
+  }
+
+  const std::function<bool(const std::string&)> shouldMap =
+      [&](const std::string& pluginName) {
+        return pluginsToRefresh.count(Filename(pluginName)) != 0;
+      };
+
+  const std::function<PluginItem(
+      const PluginInterface* const, std::optional<short>, bool)>
+      mapper = [&](const PluginInterface* const plugin,
+                   std::optional<short> loadOrderIndex,
+                   bool isActive) {
+        return PluginItem(*plugin, game, loadOrderIndex, isActive, language);
+      };
+
+  auto pluginItems =
+      MapFromLoadOrderData(game, game.GetLoadOrder(), shouldMap, mapper);
+
+  pluginItemModel->updatePluginItems(std::move(pluginItems));
+}
+
+void MainWindow::updateGameFilesWatcher() {
+  // Any changes made so far are reflected in the data that was just loaded.
+  pendingGameFilesChanges = GameFilesChanges();
+
+  if (state.getSettings().isGameFilesWatchingEnabled() &&
+      state.HasCurrentGame()) {
+    gameFilesWatcher->watch(state.GetCurrentGame());
+  } else {
+    gameFilesWatcher->stop();
   }
 }
 
+void MainWindow::refreshChangedGameFiles() {
+  if (pendingGameFilesChanges.IsEmpty()) {
+    return;
+  }
+
+  // Don't change the game's data while something else is using it, or while
+  // the user is editing metadata or reviewing a sorted load order. This
+  // function gets called again once they've finished.
+  if (runningTaskExecutorCount > 0 || !actionRefreshContent->isEnabled() ||
+      !state.HasCurrentGame()) {
+    return;
+  }
+
+  std::unique_ptr<Query> query = std::make_unique<RefreshChangedPluginsQuery>(
+      state.GetCurrentGame(),
+      state.getSettings().getLanguage(),
+      std::move(pendingGameFilesChanges),
+      pluginItemModel->getPluginItems());
+  pendingGameFilesChanges = GameFilesChanges();
+
+  // The query changes the game's data and rebuilds the plugin items from the
+  // current ones, so block the UI like any other query that does so until it
+  // has finished.
+  handleProgressUpdate(translate("Reloading changed game files..."));
+
+  executeBackgroundQuery(
+      std::move(query), &MainWindow::handleChangedGameFilesLoaded, nullptr);
+}
+
+void MainWindow::prefetchPluginsIfIdle() {
+  // Only prefetch once a newly selected game's data has been loaded and
+  // nothing else is using the game, so that it doesn't slow down anything
+  // that the user is waiting on. Reloading the game's plugins later discards
+  // the prefetched plugins, but prefetching them again each time would keep
+  // a second full copy of them loading in the background for little benefit.
+  if (!isPluginsPrefetchPending || runningTaskExecutorCount > 0 ||
+      prefetchPluginsTask->isRunning() ||
+      prefetchPluginsTask->hasResult() || !state.HasCurrentGame() ||
+      pluginItemModel->getPluginItems().empty() ||
+      state.GetCurrentGame().ArePluginsFullyLoaded()) {
+    return;
+  }
+
+  isPluginsPrefetchPending = false;
+  prefetchPluginsTask->start(state.GetCurrentGame());
+}
+
+void MainWindow::applyPrefetchedPlugins() {
+  // Queries may be reading the game's plugins, so wait until they've
+  // finished before changing them.
+  if (runningTaskExecutorCount > 0 || !prefetchPluginsTask->hasResult() ||
+      !state.HasCurrentGame()) {
+    return;
+  }
+
+  auto result = prefetchPluginsTask->takeResult();
+  state.GetCurrentGame().SetPrefetchedPlugins(std::move(result.value()));
+}
+
 bool MainWindow::hasErrorMessages() const {
   const auto counters = GeneralInformationCounters(
       pluginItemModel->getGeneralMessages(), pluginItemModel->getPluginItems());
@@ -1033,13 +1181,13 @@ void MainWindow::sortPlugins(bool isAutoSort) {
   if (state.getSettings().isMasterlistUpdateBeforeSortEnabled()) {
     handleProgressUpdate(translate("Updating and parsing masterlist..."));
 
-    const auto preludeTask = new UpdatePreludeTask(state);
+    const auto preludeTask = new UpdatePreludeTask(state, *networkSession);
     connect(preludeTask, &Task::error, this, &MainWindow::handleError);
 
     tasks.push_back(preludeTask);
 
     const auto masterlistTask =
-        new UpdateMasterlistTask(state.GetCurrentGame());
+        new UpdateMasterlistTask(state.GetCurrentGame(), *networkSession);
 
     connect(masterlistTask, &Task::error, this, &MainWindow::handleError);
 
@@ -1074,7 +1222,7 @@ void MainWindow::sortPlugins(bool isAutoSort) {
 }
 
 void MainWindow::showFirstRunDialog() {
-  auto zipPath = createBackup();
+  auto backupPath = createBackup();
 
   std::string textTemplate = R"(
 <p>{}</p>
@@ -1088,11 +1236,17 @@ void MainWindow::showFirstRunDialog() {
 )";
 
   std::string paragraph1;
-  if (zipPath.has_value()) {
-    auto zipPathString = zipPath.value().u8string();
-    auto link = "<pre><a href=\"file:" + zipPathString +
-                "\" style=\"white-space: nowrap\">" + zipPathString +
-                "</a></pre>";
+  if (backupPath.has_value() && isIncrementalBackup(backupPath.value())) {
+    paragraph1 = fmt::format(
+        boost::locale::translate(
+            "This appears to be the first time you have run LOOT v{0}. Your "
+            "current LOOT data has been backed up incrementally, and the list "
+            "of backed-up files has been saved to: {1}")
+            .str(),
+        gui::Version::string(),
+        getFileLink(backupPath.value()));
+  } else if (backupPath.has_value()) {
+    const auto link = getFileLink(backupPath.value());
 
     paragraph1 = fmt::format(
         boost::locale::translate(
@@ -1231,6 +1385,16 @@ void MainWindow::closeEvent(QCloseEvent* event) {
     }
   }
 
+  // Report any error from the final writes directly, as queued reports
+  // wouldn't be shown once the window has closed.
+  state.SetUserMetadataWriteErrorHandler(nullptr);
+
+  try {
+    state.FlushUserMetadata();
+  } catch (const std::exception& e) {
+    handleUserMetadataWriteError(e.what());
+  }
+
   try {
     state.getSettings().storeLastGame(
         state.GetCurrentGame().GetSettings().FolderName());
@@ -1298,6 +1462,11 @@ void MainWindow::executeBackgroundTasks(
           this,
           &MainWindow::handleWorkerThreadFinished);
 
+  runningTaskExecutorCount += 1;
+
+  // Give way to whatever is about to run.
+  prefetchPluginsTask->cancel();
+
   executor->start();
 }
 
@@ -1308,6 +1477,21 @@ void MainWindow::handleError(const std::string& message) {
       this, translate("Error"), QString::fromStdString(message));
 }
 
+void MainWindow::handleUserMetadataWriteError(const std::string& error) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->error("Failed to save user metadata: {}", error);
+  }
+
+  const auto message = fmt::format(
+      boost::locale::translate("Your user metadata could not be saved: {0}")
+          .str(),
+      error);
+
+  QMessageBox::critical(
+      this, translate("Error"), QString::fromStdString(message));
+}
+
 void MainWindow::handleException(const std::exception& exception) {
   auto logger = getLogger();
   if (logger) {
@@ -1409,7 +1593,16 @@ std::optional<std::filesystem::path> MainWindow::createBackup() {
       QDateTime::currentDateTime().toString("yyyyMMddThhmmss").toStdString();
 
   auto sourceDir = state.getLootDataPath();
-  auto destDir = state.getLootDataPath() / "backups" / backupBasename;
+  auto backupsDir = state.getLootDataPath() / "backups";
+
+  // Make sure that the userlists on disk include all user metadata edits.
+  state.FlushUserMetadata();
+
+  if (state.getSettings().isIncrementalBackupEnabled()) {
+    return loot::createIncrementalBackup(sourceDir, backupsDir, backupBasename);
+  }
+
+  auto destDir = backupsDir / backupBasename;
 
   loot::createBackup(sourceDir, destDir);
 
@@ -1471,7 +1664,7 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
 
     std::vector<Task*> tasks;
 
-    const auto preludeTask = new UpdatePreludeTask(state);
+    const auto preludeTask = new UpdatePreludeTask(state, *networkSession);
 
     connect(preludeTask, &Task::error, this, &MainWindow::handleError);
 
@@ -1484,7 +1677,8 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
       const auto task = new UpdateMasterlistTask(
           settings.FolderName(),
           settings.MasterlistSource(),
-          GetMasterlistPath(state.getLootDataPath(), settings));
+          GetMasterlistPath(state.getLootDataPath(), settings),
+          *networkSession);
 
       connect(task, &Task::error, this, &MainWindow::handleError);
 
@@ -1505,17 +1699,22 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
 
 void MainWindow::on_actionBackupData_triggered() {
   try {
-    auto zipPath = createBackup();
-
-    if (zipPath.has_value()) {
-      auto zipPathString = zipPath.value().u8string();
-      auto link = "<pre><a href=\"file:" + zipPathString +
-                  "\" style=\"white-space: nowrap\">" + zipPathString +
-                  "</a></pre>";
-      auto message = fmt::format(
-          boost::locale::translate("Your LOOT data has been backed up to: {0}")
-              .str(),
-          link);
+    const auto backupPath = createBackup();
+
+    if (backupPath.has_value()) {
+      const auto link = getFileLink(backupPath.value());
+      const auto message =
+          isIncrementalBackup(backupPath.value())
+              ? fmt::format(boost::locale::translate(
+                                "Your LOOT data has been backed up "
+                                "incrementally, and the list of backed-up "
+                                "files has been saved to: {0}")
+                                .str(),
+                            link)
+              : fmt::format(boost::locale::translate(
+                                "Your LOOT data has been backed up to: {0}")
+                                .str(),
+                            link);
 
       QMessageBox::information(this, "LOOT", QString::fromStdString(message));
     } else {
@@ -1536,7 +1735,7 @@ void MainWindow::on_actionOpenGroupsEditor_triggered() {
     std::set<std::string> installedPluginGroups;
     for (const auto& plugin : pluginItemModel->getPluginItems()) {
       if (plugin.group.has_value()) {
-        installedPluginGroups.insert(plugin.group.value());
+        installedPluginGroups.insert(plugin.group.value().str());
       }
     }
 
@@ -2060,10 +2259,11 @@ void MainWindow::on_actionUpdateMasterlist_triggered() {
   try {
     handleProgressUpdate(translate("Updating and parsing masterlist..."));
 
-    const auto preludeTask = new UpdatePreludeTask(state);
+    const auto preludeTask = new UpdatePreludeTask(state, *networkSession);
     connect(preludeTask, &Task::error, this, &MainWindow::handleError);
 
-    auto masterlistTask = new UpdateMasterlistTask(state.GetCurrentGame());
+    auto masterlistTask =
+        new UpdateMasterlistTask(state.GetCurrentGame(), *networkSession);
 
     connect(masterlistTask, &Task::error, this, &MainWindow::handleError);
 
@@ -2198,34 +2398,40 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
 void MainWindow::on_pluginItemModel_rowsInserted(const QModelIndex&,
                                                  int first,
                                                  int last) {
+  cardSizingCache.insertRows(first, last);
   cardSizingCache.update(pluginItemModel, first, last);
 }
 
+void MainWindow::on_pluginItemModel_rowsRemoved(const QModelIndex&,
+                                                int first,
+                                                int last) {
+  cardSizingCache.removeRows(first, last);
+}
+
+void MainWindow::on_pluginItemModel_rowsMoved(const QModelIndex&,
+                                              int first,
+                                              int last,
+                                              const QModelIndex&,
+                                              int destinationRow) {
+  cardSizingCache.moveRows(first, last, destinationRow);
+}
+
 void MainWindow::on_pluginEditorWidget_accepted(PluginMetadata userMetadata) {
   try {
     auto logger = getLogger();
-    auto pluginName = userMetadata.GetName();
-
-    // Erase any existing userlist entry.
     if (logger) {
-      logger->trace("Erasing the existing userlist entry.");
-    }
-    state.GetCurrentGame().ClearUserMetadata(pluginName);
-
-    // Add a new userlist entry if necessary.
-    if (!userMetadata.HasNameOnly()) {
-      if (logger) {
-        logger->trace("Adding new metadata to new userlist entry.");
-      }
-      state.GetCurrentGame().AddUserMetadata(userMetadata);
+      logger->trace("Replacing the existing userlist entry.");
     }
 
-    // Save edited userlist.
-    state.GetCurrentGame().SaveUserMetadata();
+    // Replacing the userlist entry also saves the edited userlist.
+    UserMetadataTransaction transaction;
+    transaction.ReplaceUserMetadata(userMetadata);
+    const auto pluginNames =
+        state.GetCurrentGame().ApplyUserMetadataTransaction(transaction);
 
     pluginItemModel->setEditorPluginName(std::nullopt);
 
-    refreshPluginRawData(pluginName);
+    refreshPluginRawData(pluginNames);
 
     state.DecrementUnappliedChangeCounter();
 
@@ -2289,6 +2495,31 @@ void MainWindow::on_settingsDialog_accepted() {
     if (state.getSettings().getTheme() != currentTheme) {
       applyTheme();
     }
+
+    if (state.getSettings().isGameFilesWatchingEnabled() !=
+        gameFilesWatcher->isWatching()) {
+      updateGameFilesWatcher();
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::on_gameFilesWatcher_changed(const GameFilesChanges& changes) {
+  pendingGameFilesChanges.Merge(changes);
+
+  refreshChangedGameFiles();
+}
+
+void MainWindow::on_prefetchPluginsTask_finished() {
+  try {
+    applyPrefetchedPlugins();
+
+    // If the prefetch gave way to something else, try again once it's done.
+    if (prefetchPluginsTask->wasCancelled()) {
+      isPluginsPrefetchPending = true;
+      prefetchPluginsIfIdle();
+    }
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2296,27 +2527,19 @@ void MainWindow::on_settingsDialog_accepted() {
 
 void MainWindow::on_groupsEditor_accepted() {
   try {
-    state.GetCurrentGame().SetUserGroups(groupsEditor->getUserGroups());
+    UserMetadataTransaction transaction;
+    transaction.SetUserGroups(groupsEditor->getUserGroups());
 
     for (const auto& [pluginName, groupName] :
          groupsEditor->getNewPluginGroups()) {
-      // Update the plugin's group in user metadata.
-      auto userMetadata = state.GetCurrentGame().GetUserMetadata(pluginName);
-
-      if (userMetadata.has_value()) {
-        userMetadata.value().SetGroup(groupName);
-        state.GetCurrentGame().AddUserMetadata(userMetadata.value());
-      } else {
-        PluginMetadata metadata(pluginName);
-        metadata.SetGroup(groupName);
-        state.GetCurrentGame().AddUserMetadata(metadata);
-      }
-
-      // Now update the plugin in the UI's plugin item model.
-      refreshPluginRawData(pluginName);
+      transaction.SetPluginGroup(pluginName, groupName);
     }
 
-    state.GetCurrentGame().SaveUserMetadata();
+    const auto pluginNames =
+        state.GetCurrentGame().ApplyUserMetadataTransaction(transaction);
+
+    // Now update the edited plugins in the UI's plugin item model.
+    refreshPluginRawData(pluginNames);
 
     SaveGroupNodePositions(state.GetCurrentGame().GroupNodePositionsPath(),
                            groupsEditor->getNodePositions());
@@ -2328,34 +2551,14 @@ void MainWindow::on_groupsEditor_accepted() {
 void MainWindow::on_searchDialog_finished() { searchDialog->reset(); }
 
 void MainWindow::on_searchDialog_textChanged(const QVariant& text) {
-  const auto isEmpty =
-      (text.userType() == QMetaType::QString && text.toString().isEmpty()) ||
-      (text.userType() == QMetaType::QRegularExpression &&
-       text.toRegularExpression().pattern().isEmpty());
-
-  if (isEmpty) {
+  if (isSearchTextEmpty(text)) {
+    searchTimer->stop();
+    searchPluginsTask->cancel();
     proxyModel->clearSearchResults();
     return;
   }
 
-  if (text.userType() == QMetaType::QRegularExpression &&
-      !text.toRegularExpression().isValid()) {
-    // Do nothing if given an invalid regex.
-  }
-
-  const auto flags = text.userType() == QMetaType::QRegularExpression
-                         ? Qt::MatchRegularExpression | Qt::MatchWrap
-                         : Qt::MatchContains | Qt::MatchWrap;
-
-  auto results =
-      proxyModel->match(proxyModel->index(0, PluginItemModel::CARDS_COLUMN),
-                        ContentSearchRole,
-                        text,
-                        -1,
-                        flags);
-
-  proxyModel->setSearchResults(results);
-  searchDialog->setSearchResults(results.size());
+  searchTimer->start();
 }
 
 void MainWindow::on_searchDialog_currentResultChanged(size_t resultIndex) {
@@ -2365,13 +2568,46 @@ void MainWindow::on_searchDialog_currentResultChanged(size_t resultIndex) {
   pluginCardsView->scrollTo(proxyIndex, QAbstractItemView::PositionAtTop);
 }
 
+void MainWindow::on_searchTimer_timeout() {
+  const auto text = searchDialog->getSearchText();
+
+  // Only the search text has changed, so if it has been extended then only the
+  // previous search's results need to be searched again.
+  if (!searchPluginsTask->startNarrowing(text)) {
+    searchPlugins(text);
+  }
+}
+
+void MainWindow::on_searchPluginsTask_finished(
+    const std::vector<std::string>& resultNames) {
+  // The model may have changed while searching, so match results by name.
+  const std::unordered_set<std::string> resultNamesSet(resultNames.begin(),
+                                                       resultNames.end());
+  const auto& pluginItems = pluginItemModel->getPluginItems();
+
+  QModelIndexList results;
+  for (int row = 1; row < proxyModel->rowCount(); row += 1) {
+    const auto index = proxyModel->index(row, PluginItemModel::CARDS_COLUMN);
+    const auto sourceIndex = proxyModel->mapToSource(index);
+    const auto& name = pluginItems.at(sourceIndex.row() - 1).name;
+
+    if (resultNamesSet.count(name) > 0) {
+      results.push_back(index);
+    }
+  }
+
+  proxyModel->setSearchResults(results);
+  searchDialog->setSearchResults(results.size());
+}
+
 void MainWindow::handleGameChanged(QueryResult result) {
   try {
-    filtersWidget->setGameId(state.GetCurrentGame().GetSettings().Id());
     filtersWidget->resetConflictsAndGroupsFilters();
     disablePluginActions();
 
     handleGameDataLoaded(result);
+    isPluginsPrefetchPending = true;
+    updateGameFilesWatcher();
 
     updateSidebarColumnWidths();
 
@@ -2386,6 +2622,7 @@ void MainWindow::handleGameChanged(QueryResult result) {
 void MainWindow::handleRefreshGameDataLoaded(QueryResult result) {
   try {
     handleGameDataLoaded(result);
+    updateGameFilesWatcher();
 
     // Perform ambiguous load order check because load order state was refreshed
     // when refreshing game data.
@@ -2398,6 +2635,8 @@ void MainWindow::handleRefreshGameDataLoaded(QueryResult result) {
 void MainWindow::handleStartupGameDataLoaded(QueryResult result) {
   try {
     handleGameDataLoaded(result);
+    isPluginsPrefetchPending = true;
+    updateGameFilesWatcher();
 
     if (state.getSettings().isAutoSortEnabled()) {
       if (hasErrorMessages()) {
@@ -2601,6 +2840,18 @@ void MainWindow::handleConflictsChecked(QueryResult result) {
   }
 }
 
+void MainWindow::handleChangedGameFilesLoaded(QueryResult result) {
+  try {
+    pluginItemModel->setPluginItems(std::move(std::get<PluginItems>(result)));
+
+    // Reloading plugins or the load order may have added or removed general
+    // messages.
+    updateGeneralMessages();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::handleProgressUpdate(const QString& message) {
   progressDialog->open();
   progressDialog->setLabelText(message);
@@ -2654,7 +2905,19 @@ void MainWindow::handleUpdateCheckError(const std::string&) {
   }
 }
 
-void MainWindow::handleWorkerThreadFinished() { progressDialog->reset(); }
+void MainWindow::handleWorkerThreadFinished() {
+  progressDialog->reset();
+
+  runningTaskExecutorCount -= 1;
+
+  applyPrefetchedPlugins();
+
+  // Apply any changes to the game's files that were made while the game's
+  // data was in use.
+  refreshChangedGameFiles();
+
+  prefetchPluginsIfIdle();
+}
 
 void MainWindow::handleIconColorChanged() {
   IconFactory::setColours(
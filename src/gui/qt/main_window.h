@@ -26,6 +26,7 @@
 #ifndef LOOT_GUI_QT_MAIN_WINDOW
 #define LOOT_GUI_QT_MAIN_WINDOW
 
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
 #include <QtCore/QVariant>
 #include <QtCore/QtGlobal>
@@ -57,12 +58,16 @@
 
 #include "gui/qt/card_delegate.h"
 #include "gui/qt/filters_widget.h"
+#include "gui/qt/game_files_watcher.h"
 #include "gui/qt/groups_editor/groups_editor_dialog.h"
+#include "gui/qt/network_session.h"
 #include "gui/qt/plugin_editor/plugin_editor_widget.h"
 #include "gui/qt/plugin_item_filter_model.h"
 #include "gui/qt/plugin_item_model.h"
 #include "gui/qt/search_dialog.h"
 #include "gui/qt/settings/settings_dialog.h"
+#include "gui/qt/tasks/prefetch_plugins_task.h"
+#include "gui/qt/tasks/search_plugins_task.h"
 #include "gui/qt/tasks/tasks.h"
 #include "gui/query/query.h"
 #include "gui/state/loot_state.h"
@@ -162,6 +167,15 @@ private:
   GroupsEditorDialog *groupsEditor{
       new GroupsEditorDialog(this, pluginItemModel)};
 
+  GameFilesWatcher *gameFilesWatcher{new GameFilesWatcher(this)};
+  GameFilesChanges pendingGameFilesChanges;
+  int runningTaskExecutorCount{0};
+  PrefetchPluginsTask *prefetchPluginsTask{new PrefetchPluginsTask(this)};
+  bool isPluginsPrefetchPending{false};
+  QTimer *searchTimer{new QTimer(this)};
+  SearchPluginsTask *searchPluginsTask{new SearchPluginsTask(this)};
+  NetworkSession *networkSession{new NetworkSession(this)};
+
   std::optional<QPersistentModelIndex> lastEnteredCardIndex;
 
   QColor normalIconColor;
@@ -204,7 +218,12 @@ private:
   void setFiltersState(PluginFiltersState &&state,
                        std::vector<std::string> &&conflictingPluginNames);
   void refreshSearch();
-  void refreshPluginRawData(const std::string &pluginName);
+  void searchPlugins(const QVariant &text);
+  void refreshPluginRawData(const std::vector<std::string> &pluginNames);
+  void updateGameFilesWatcher();
+  void refreshChangedGameFiles();
+  void prefetchPluginsIfIdle();
+  void applyPrefetchedPlugins();
 
   bool hasErrorMessages() const;
 
@@ -228,6 +247,7 @@ private:
 
   void handleError(const std::string &message);
   void handleException(const std::exception &exception);
+  void handleUserMetadataWriteError(const std::string &error);
   void handleQueryException(const Query &query,
                             const std::exception &exception);
 
@@ -284,6 +304,14 @@ private slots:
   void on_pluginItemModel_rowsInserted(const QModelIndex &,
                                        int first,
                                        int last);
+  void on_pluginItemModel_rowsRemoved(const QModelIndex &,
+                                      int first,
+                                      int last);
+  void on_pluginItemModel_rowsMoved(const QModelIndex &,
+                                    int first,
+                                    int last,
+                                    const QModelIndex &,
+                                    int destinationRow);
 
   void on_pluginEditorWidget_accepted(PluginMetadata userMetadata);
   void on_pluginEditorWidget_rejected();
@@ -295,11 +323,18 @@ private slots:
 
   void on_settingsDialog_accepted();
 
+  void on_gameFilesWatcher_changed(const GameFilesChanges &changes);
+
+  void on_prefetchPluginsTask_finished();
+
   void on_groupsEditor_accepted();
 
   void on_searchDialog_finished();
   void on_searchDialog_textChanged(const QVariant &text);
   void on_searchDialog_currentResultChanged(size_t resultIndex);
+  void on_searchTimer_timeout();
+  void on_searchPluginsTask_finished(
+      const std::vector<std::string> &resultNames);
 
   void handleGameChanged(QueryResult result);
   void handleRefreshGameDataLoaded(QueryResult result);
@@ -309,6 +344,7 @@ private slots:
   void handleMasterlistUpdated(std::vector<QueryResult> results);
   void handleMasterlistsUpdated(std::vector<QueryResult> results);
   void handleConflictsChecked(QueryResult result);
+  void handleChangedGameFilesLoaded(QueryResult result);
   void handleProgressUpdate(const QString &message);
   void handleUpdateCheckFinished(QueryResult result);
   void handleUpdateCheckError(const std::string &);
@@ -29,6 +29,7 @@
 #include <QtWidgets/QGridLayout>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QStyle>
+#include <cmath>
 
 #include "gui/sourced_message.h"
 
@@ -37,6 +38,7 @@ static constexpr const char* MESSAGE_TYPE_PROPERTY = "messageType";
 static constexpr int COLUMN_COUNT = 2;
 static constexpr int BULLET_POINT_COLUMN = 0;
 static constexpr int MESSAGE_LABEL_COLUMN = 1;
+static constexpr const char* BULLET_POINT = u8"\u2022";
 
 QString getPropertyValue(MessageType messageType) {
   switch (messageType) {
@@ -68,21 +70,19 @@ QString getHtmlText(const std::string& markdownText) {
   return html;
 }
 
+QMargins getLabelMargins(const QStyle& style) {
+  return QMargins(style.pixelMetric(QStyle::PM_LayoutLeftMargin),
+                  style.pixelMetric(QStyle::PM_LayoutTopMargin),
+                  style.pixelMetric(QStyle::PM_LayoutRightMargin),
+                  style.pixelMetric(QStyle::PM_LayoutBottomMargin));
+}
+
 QLabel* createBulletPointLabel() {
   auto label = new QLabel();
   label->setTextFormat(Qt::TextFormat::PlainText);
-  label->setText(QString(u8"\u2022"));
+  label->setText(QString(BULLET_POINT));
 
-  const auto leftMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutLeftMargin);
-  const auto topMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutTopMargin);
-  const auto rightMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutRightMargin);
-  const auto bottomMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutBottomMargin);
-
-  label->setContentsMargins(leftMargin, topMargin, rightMargin, bottomMargin);
+  label->setContentsMargins(getLabelMargins(*label->style()));
 
   return label;
 }
@@ -94,16 +94,7 @@ QLabel* createMessageLabel() {
   label->setWordWrap(true);
   label->setOpenExternalLinks(true);
 
-  const auto leftMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutLeftMargin);
-  const auto topMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutTopMargin);
-  const auto rightMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutRightMargin);
-  const auto bottomMargin =
-      label->style()->pixelMetric(QStyle::PM_LayoutBottomMargin);
-
-  label->setContentsMargins(leftMargin, topMargin, rightMargin, bottomMargin);
+  label->setContentsMargins(getLabelMargins(*label->style()));
 
   return label;
 }
@@ -133,7 +124,7 @@ std::vector<BareMessage> toBareMessages(
     const std::vector<SourcedMessage>& messages) {
   std::vector<BareMessage> bareMessages;
   for (const auto& message : messages) {
-    bareMessages.push_back(BareMessage{message.type, message.text});
+    bareMessages.push_back(BareMessage{message.type, message.text.str()});
   }
 
   return bareMessages;
@@ -152,6 +143,45 @@ void MessagesWidget::setMessages(const std::vector<SourcedMessage>& messages) {
 
 void MessagesWidget::refresh() { setMessages(currentMessages); }
 
+int MessagesWidget::estimateHeightForWidth(
+    const std::vector<std::string>& messageTexts,
+    int width) const {
+  ensurePolished();
+
+  // This mirrors the layout that setMessages() builds, without creating any
+  // labels: each row is as tall as the taller of its bullet point label and
+  // its word-wrapped message label.
+  const auto margins = getLabelMargins(*style());
+  const auto horizontalMargins = margins.left() + margins.right();
+  const auto verticalMargins = margins.top() + margins.bottom();
+
+  const auto metrics = fontMetrics();
+  const auto bulletPointWidth =
+      metrics.horizontalAdvance(QString(BULLET_POINT)) + horizontalMargins;
+  const auto bulletPointHeight = metrics.height() + verticalMargins;
+
+  const auto textWidth =
+      std::max(1, width - bulletPointWidth - horizontalMargins);
+
+  QTextDocument document;
+  document.setDefaultFont(font());
+  document.setDocumentMargin(0);
+
+  int height = 0;
+  for (const auto& text : messageTexts) {
+    document.setHtml(getHtmlText(text));
+    document.setTextWidth(textWidth);
+
+    const auto textHeight =
+        static_cast<int>(std::ceil(document.size().height())) +
+        verticalMargins;
+
+    height += std::max(bulletPointHeight, textHeight);
+  }
+
+  return height;
+}
+
 void MessagesWidget::setupUi() {
   // Bullet points rendered using rich text are positioned uncomfortably close
   // to the text following them, and there's no way to change that. Use a
@@ -43,6 +43,11 @@ public:
 
   void refresh();
 
+  // Estimate the height that the given messages would be laid out in at the
+  // given width, without changing the widget's content.
+  int estimateHeightForWidth(const std::vector<std::string>& messageTexts,
+                             int width) const;
+
 private:
   std::vector<BareMessage> currentMessages;
 
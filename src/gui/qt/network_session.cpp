@@ -0,0 +1,211 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/network_session.h"
+
+#include <QtNetwork/QNetworkAccessManager>
+#include <QtNetwork/QNetworkReply>
+#include <deque>
+#include <unordered_map>
+
+#include "gui/qt/helpers.h"
+#include "gui/state/logging.h"
+
+namespace loot {
+class NetworkSession::Worker : public QObject {
+public:
+  explicit Worker(size_t maxConcurrentRequests) :
+      maxConcurrentRequests(maxConcurrentRequests) {}
+
+  void get(const QNetworkRequest& request, NetworkResponseRelay* relay) {
+    // Delete the relays of requests that are still pending when the worker is
+    // destroyed.
+    relay->setParent(this);
+
+    queuedRequests.push_back(PendingRequest{request, relay});
+    sendQueuedRequests();
+  }
+
+private:
+  static constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+  struct PendingRequest {
+    QNetworkRequest request;
+    NetworkResponseRelay* relay{nullptr};
+  };
+
+  struct CachedResponse {
+    QByteArray eTag;
+    QByteArray lastModified;
+    QByteArray data;
+  };
+
+  void sendQueuedRequests() {
+    // Delay construction of the manager so that it's created in the session's
+    // thread.
+    if (networkAccessManager == nullptr) {
+      networkAccessManager = new QNetworkAccessManager(this);
+    }
+
+    while (activeRequests < maxConcurrentRequests && !queuedRequests.empty()) {
+      send(queuedRequests.front());
+      queuedRequests.pop_front();
+    }
+  }
+
+  void send(const PendingRequest& pendingRequest) {
+    auto request = pendingRequest.request;
+    request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+
+    const auto cacheKey = request.url().toString();
+    const auto cached = cache.find(cacheKey);
+    if (cached != cache.end()) {
+      if (!cached->second.eTag.isEmpty()) {
+        request.setRawHeader("If-None-Match", cached->second.eTag);
+      }
+      if (!cached->second.lastModified.isEmpty()) {
+        request.setRawHeader("If-Modified-Since",
+                             cached->second.lastModified);
+      }
+    }
+
+    const auto reply = networkAccessManager->get(request);
+    activeRequests += 1;
+
+    connect(reply, &QNetworkReply::sslErrors, this, &Worker::onSSLErrors);
+    connect(
+        reply, &QNetworkReply::finished, this, [this, reply, pendingRequest]() {
+          activeRequests -= 1;
+
+          const auto response = readResponse(reply);
+
+          // The relay's signal is queued for the request's context object
+          // (if it still exists), so the relay can be deleted straight away.
+          emit pendingRequest.relay->responseReceived(response);
+          delete pendingRequest.relay;
+
+          sendQueuedRequests();
+        });
+  }
+
+  NetworkResponse readResponse(QNetworkReply* reply) {
+    const auto logger = getLogger();
+    const auto cacheKey = reply->request().url().toString();
+
+    if (reply->error() != QNetworkReply::NoError) {
+      const auto errorString = reply->errorString().toStdString();
+      if (logger) {
+        logger->error("Network error code {}, description is: {}",
+                      reply->error(),
+                      errorString);
+      }
+
+      reply->deleteLater();
+
+      return NetworkResponse{std::nullopt, errorString};
+    }
+
+    const auto statusCode =
+        reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    const auto cached = cache.find(cacheKey);
+    if (statusCode == HTTP_STATUS_NOT_MODIFIED && cached != cache.end()) {
+      if (logger) {
+        logger->trace("Using cached response for GET {}",
+                      cacheKey.toStdString());
+      }
+
+      reply->deleteLater();
+
+      return NetworkResponse{cached->second.data, std::nullopt};
+    }
+
+    auto eTag = reply->rawHeader("ETag");
+    auto lastModified = reply->rawHeader("Last-Modified");
+    auto data = readHttpResponse(reply);
+
+    if (data.has_value() && (!eTag.isEmpty() || !lastModified.isEmpty())) {
+      cache.insert_or_assign(
+          cacheKey,
+          CachedResponse{
+              std::move(eTag), std::move(lastModified), data.value()});
+    }
+
+    return NetworkResponse{data, std::nullopt};
+  }
+
+  void onSSLErrors(const QList<QSslError>& errors) {
+    const auto logger = getLogger();
+    if (!logger) {
+      return;
+    }
+
+    for (const auto& error : errors) {
+      logger->error("SSL error: {}", error.errorString().toStdString());
+    }
+  }
+
+  size_t maxConcurrentRequests{0};
+  size_t activeRequests{0};
+  std::deque<PendingRequest> queuedRequests;
+  std::unordered_map<QString, CachedResponse> cache;
+  QNetworkAccessManager* networkAccessManager{nullptr};
+};
+
+NetworkSession::NetworkSession(QObject* parent, size_t maxConcurrentRequests) :
+    QObject(parent), worker(new Worker(maxConcurrentRequests)) {
+  qRegisterMetaType<NetworkResponse>("NetworkResponse");
+
+  worker->moveToThread(&thread);
+  connect(&thread, &QThread::finished, worker, &QObject::deleteLater);
+
+  thread.setObjectName("networkSessionThread");
+  thread.start();
+}
+
+NetworkSession::~NetworkSession() {
+  thread.quit();
+  thread.wait();
+}
+
+void NetworkSession::get(const QNetworkRequest& request,
+                         QObject* context,
+                         Callback callback) {
+  // The response is sent through a queued connection to the context object,
+  // so Qt runs the callback in its thread and disconnects it if the context
+  // object is destroyed first.
+  const auto relay = new NetworkResponseRelay();
+  connect(relay,
+          &NetworkResponseRelay::responseReceived,
+          context,
+          std::move(callback),
+          Qt::QueuedConnection);
+  relay->moveToThread(&thread);
+
+  QMetaObject::invokeMethod(
+      worker,
+      [worker = worker, request, relay]() { worker->get(request, relay); },
+      Qt::QueuedConnection);
+}
+}
@@ -0,0 +1,97 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_NETWORK_SESSION
+#define LOOT_GUI_QT_NETWORK_SESSION
+
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <QtNetwork/QNetworkRequest>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace loot {
+struct NetworkResponse {
+  // Empty if the request failed or got an unsuccessful HTTP status code.
+  std::optional<QByteArray> data;
+  // Set if the request failed, describes why.
+  std::optional<std::string> error;
+};
+}
+
+Q_DECLARE_METATYPE(loot::NetworkResponse);
+
+namespace loot {
+// Carries a response from the session's thread to the object that requested
+// it.
+class NetworkResponseRelay : public QObject {
+  Q_OBJECT
+signals:
+  void responseReceived(const NetworkResponse& response);
+};
+
+// Sends the HTTP requests for all network tasks using one network access
+// manager that lives in a dedicated thread, so that connections are reused
+// across tasks instead of each task paying for its own DNS lookups, TCP
+// connections and TLS handshakes, and HTTP/2 can be used to send concurrent
+// requests to a host over one connection.
+//
+// The number of requests in flight is limited, and successful responses are
+// cached in memory so that later requests for the same URL can be sent as
+// conditional requests, reusing the cached data if the server responds with
+// 304 Not Modified.
+class NetworkSession : public QObject {
+  Q_OBJECT
+public:
+  using Callback = std::function<void(const NetworkResponse&)>;
+
+  static constexpr size_t DEFAULT_MAX_CONCURRENT_REQUESTS = 4;
+
+  explicit NetworkSession(
+      QObject* parent = nullptr,
+      size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS);
+  NetworkSession(const NetworkSession&) = delete;
+  NetworkSession(NetworkSession&&) = delete;
+  ~NetworkSession();
+
+  NetworkSession& operator=(const NetworkSession&) = delete;
+  NetworkSession& operator=(NetworkSession&&) = delete;
+
+  // Sends a GET request. This can be called from any thread. The callback is
+  // run in the context object's thread, unless the context object has been
+  // destroyed by the time the response is received. The context object must
+  // not be null.
+  void get(const QNetworkRequest& request, QObject* context, Callback callback);
+
+private:
+  class Worker;
+
+  QThread thread;
+  Worker* worker{nullptr};
+};
+}
+
+#endif
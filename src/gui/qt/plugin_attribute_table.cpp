@@ -0,0 +1,198 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_attribute_table.h"
+
+#include "gui/qt/counters.h"
+
+namespace loot {
+PluginBitset::PluginBitset(size_t size, bool value) :
+    bitCount(size),
+    words((size + WORD_BITS - 1) / WORD_BITS, value ? ~uint64_t{0} : 0) {}
+
+size_t PluginBitset::size() const { return bitCount; }
+
+bool PluginBitset::test(size_t index) const {
+  return (words.at(index / WORD_BITS) >> (index % WORD_BITS)) & 1;
+}
+
+void PluginBitset::set(size_t index, bool value) {
+  const auto mask = uint64_t{1} << (index % WORD_BITS);
+  auto& word = words.at(index / WORD_BITS);
+
+  if (value) {
+    word |= mask;
+  } else {
+    word &= ~mask;
+  }
+}
+
+PluginBitset& PluginBitset::operator&=(const PluginBitset& other) {
+  for (size_t i = 0; i < words.size(); i += 1) {
+    words[i] &= other.words.at(i);
+  }
+
+  return *this;
+}
+
+PluginBitset& PluginBitset::subtract(const PluginBitset& other) {
+  for (size_t i = 0; i < words.size(); i += 1) {
+    words[i] &= ~other.words.at(i);
+  }
+
+  return *this;
+}
+
+bool anyMessagesVisible(const PluginItem& plugin,
+                        const CardContentFiltersState& filters) {
+  if (filters.hideAllPluginMessages) {
+    return false;
+  }
+
+  for (const auto& message : plugin.messages) {
+    if (!shouldFilterMessage(plugin, message, filters)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void PluginAttributeTable::assign(
+    const std::vector<PluginItem>& items,
+    const CardContentFiltersState& contentFilters) {
+  isActive = PluginBitset(items.size(), false);
+  hasVisibleMessages = PluginBitset(items.size(), false);
+  isCreationClubPlugin = PluginBitset(items.size(), false);
+  isEmpty = PluginBitset(items.size(), false);
+  groupIds.assign(items.size(), 0);
+  groupIdsByName.clear();
+
+  for (size_t i = 0; i < items.size(); i += 1) {
+    update(i, items[i], contentFilters);
+  }
+}
+
+void PluginAttributeTable::update(
+    size_t index,
+    const PluginItem& item,
+    const CardContentFiltersState& contentFilters) {
+  isActive.set(index, item.isActive);
+  hasVisibleMessages.set(index, anyMessagesVisible(item, contentFilters));
+  isCreationClubPlugin.set(index, item.isCreationClubPlugin);
+  isEmpty.set(index, item.isEmpty);
+  groupIds.at(index) = getGroupId(item);
+}
+
+size_t PluginAttributeTable::size() const { return groupIds.size(); }
+
+PluginBitset PluginAttributeTable::getAcceptedPlugins(
+    const PluginFiltersState& filters) const {
+  PluginBitset accepted(size(), true);
+
+  if (filters.hideInactivePlugins) {
+    accepted &= isActive;
+  }
+
+  if (filters.hideMessagelessPlugins) {
+    accepted &= hasVisibleMessages;
+  }
+
+  if (filters.hideCreationClubPlugins) {
+    accepted.subtract(isCreationClubPlugin);
+  }
+
+  if (filters.showOnlyEmptyPlugins) {
+    accepted &= isEmpty;
+  }
+
+  if (filters.groupName.has_value()) {
+    const auto groupId = findGroupId(filters.groupName.value());
+
+    PluginBitset isInGroup(size(), false);
+    if (groupId.has_value()) {
+      for (size_t i = 0; i < groupIds.size(); i += 1) {
+        isInGroup.set(i, groupIds[i] == groupId.value());
+      }
+    }
+
+    accepted &= isInGroup;
+  }
+
+  return accepted;
+}
+
+bool PluginAttributeTable::isAccepted(size_t index,
+                                      const PluginFiltersState& filters) const {
+  if (filters.hideInactivePlugins && !isActive.test(index)) {
+    return false;
+  }
+
+  if (filters.hideMessagelessPlugins && !hasVisibleMessages.test(index)) {
+    return false;
+  }
+
+  if (filters.hideCreationClubPlugins && isCreationClubPlugin.test(index)) {
+    return false;
+  }
+
+  if (filters.showOnlyEmptyPlugins && !isEmpty.test(index)) {
+    return false;
+  }
+
+  if (filters.groupName.has_value()) {
+    const auto groupId = findGroupId(filters.groupName.value());
+    return groupId.has_value() && groupIds.at(index) == groupId.value();
+  }
+
+  return true;
+}
+
+uint16_t PluginAttributeTable::getGroupId(const PluginItem& item) {
+  const auto groupName = item.group.has_value()
+                             ? item.group.value().str()
+                             : std::string(Group::DEFAULT_NAME);
+
+  const auto it = groupIdsByName.find(groupName);
+  if (it != groupIdsByName.end()) {
+    return it->second;
+  }
+
+  const auto groupId = static_cast<uint16_t>(groupIdsByName.size());
+  groupIdsByName.emplace(groupName, groupId);
+
+  return groupId;
+}
+
+std::optional<uint16_t> PluginAttributeTable::findGroupId(
+    const std::string& groupName) const {
+  const auto it = groupIdsByName.find(groupName);
+  if (it == groupIdsByName.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+}
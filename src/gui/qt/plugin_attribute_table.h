@@ -0,0 +1,97 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_ATTRIBUTE_TABLE
+#define LOOT_GUI_QT_PLUGIN_ATTRIBUTE_TABLE
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/filters_states.h"
+
+namespace loot {
+// A fixed-size set of bits, one per plugin, packed into 64-bit words so that
+// whole sets can be combined a word at a time.
+class PluginBitset {
+public:
+  PluginBitset() = default;
+  PluginBitset(size_t size, bool value);
+
+  size_t size() const;
+  bool test(size_t index) const;
+  void set(size_t index, bool value);
+
+  PluginBitset& operator&=(const PluginBitset& other);
+  // Clears the bits that are set in the other bitset.
+  PluginBitset& subtract(const PluginBitset& other);
+
+private:
+  static constexpr size_t WORD_BITS = 64;
+
+  size_t bitCount{0};
+  std::vector<uint64_t> words;
+};
+
+bool anyMessagesVisible(const PluginItem& plugin,
+                        const CardContentFiltersState& filters);
+
+// Holds the plugin attributes that the plugin filters check as columns, so
+// that the filters can be applied to all plugins at once without copying
+// their items.
+class PluginAttributeTable {
+public:
+  void assign(const std::vector<PluginItem>& items,
+              const CardContentFiltersState& contentFilters);
+  void update(size_t index,
+              const PluginItem& item,
+              const CardContentFiltersState& contentFilters);
+
+  size_t size() const;
+
+  // Returns a bitset with the bits set for the plugins that pass the filters'
+  // attribute checks. The content and conflicts filters aren't checked.
+  PluginBitset getAcceptedPlugins(const PluginFiltersState& filters) const;
+
+  // Checks a single plugin in the same way as getAcceptedPlugins().
+  bool isAccepted(size_t index, const PluginFiltersState& filters) const;
+
+private:
+  uint16_t getGroupId(const PluginItem& item);
+  std::optional<uint16_t> findGroupId(const std::string& groupName) const;
+
+  PluginBitset isActive;
+  PluginBitset hasVisibleMessages;
+  PluginBitset isCreationClubPlugin;
+  PluginBitset isEmpty;
+  std::vector<uint16_t> groupIds;
+  std::unordered_map<std::string, uint16_t> groupIdsByName;
+};
+}
+
+#endif
@@ -27,11 +27,15 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include <QtGui/QTextDocument>
+#include <QtWidgets/QGridLayout>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QStyle>
 #include <QtWidgets/QVBoxLayout>
+#include <array>
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
+#include <cmath>
 
 #include "gui/helpers.h"
 #include "gui/qt/counters.h"
@@ -45,14 +49,14 @@ void setIcon(QLabel* label, QIcon icon) {
   label->setPixmap(IconFactory::getPixmap(icon, ATTRIBUTE_ICON_HEIGHT));
 }
 
-QString getTagsText(const std::vector<std::string> tags, bool hideTags) {
+QString getTagsText(const std::vector<InternedString>& tags, bool hideTags) {
   if (hideTags) {
     return "";
   }
 
   QStringList tagsList;
   for (const auto& tag : tags) {
-    tagsList.append(QString::fromStdString(tag));
+    tagsList.append(QString::fromStdString(tag.str()));
   }
 
   if (tagsList.isEmpty()) {
@@ -69,7 +73,7 @@ std::vector<SourcedMessage> filterMessages(
 
   if (!filters.hideAllPluginMessages) {
     for (const auto& message : plugin.messages) {
-      if (!shouldFilterMessage(plugin.name, message, filters)) {
+      if (!shouldFilterMessage(plugin, message, filters)) {
         filteredMessages.push_back(message);
       }
     }
@@ -78,6 +82,53 @@ std::vector<SourcedMessage> filterMessages(
   return filteredMessages;
 }
 
+std::string getLocationsText(const std::vector<std::string>& locationLinks) {
+  std::string locationsText = locationLinks.size() == 1
+                                  ? boost::locale::translate("Source:")
+                                  : boost::locale::translate("Sources:");
+  locationsText += "  " + boost::join(locationLinks, u8" \uFF5C ");
+
+  return locationsText;
+}
+
+int getTextWidth(const QLabel& label, const QString& text) {
+  const auto margins = label.contentsMargins();
+
+  return label.fontMetrics().horizontalAdvance(text) + margins.left() +
+         margins.right() + 2 * label.margin();
+}
+
+int getWrappedTextHeight(const QLabel& label, const QString& text, int width) {
+  const auto margins = label.contentsMargins();
+  const auto textWidth = std::max(
+      1, width - margins.left() - margins.right() - 2 * label.margin());
+
+  const auto textRect =
+      label.fontMetrics().boundingRect(QRect(0, 0, textWidth, QWIDGETSIZE_MAX),
+                                       Qt::TextWordWrap,
+                                       text);
+
+  return textRect.height() + margins.top() + margins.bottom() +
+         2 * label.margin();
+}
+
+int getWrappedMarkdownHeight(const QLabel& label,
+                             const QString& markdown,
+                             int width) {
+  const auto margins = label.contentsMargins();
+  const auto textWidth = std::max(
+      1, width - margins.left() - margins.right() - 2 * label.margin());
+
+  QTextDocument document;
+  document.setDefaultFont(label.font());
+  document.setDocumentMargin(0);
+  document.setMarkdown(markdown);
+  document.setTextWidth(textWidth);
+
+  return static_cast<int>(std::ceil(document.size().height())) +
+         margins.top() + margins.bottom() + 2 * label.margin();
+}
+
 PluginCard::PluginCard(QWidget* parent) : QFrame(parent) { setupUi(); }
 
 void PluginCard::setIcons() {
@@ -152,12 +203,8 @@ void PluginCard::setContent(const PluginItem& plugin,
                             location.GetURL() + ")";
                    });
 
-    std::string locationsText = plugin.locations.size() == 1
-                                    ? boost::locale::translate("Source:")
-                                    : boost::locale::translate("Sources:");
-    locationsText += "  " + boost::join(locationLinks, u8" \uFF5C ");
-
-    locationsLabel->setText(QString::fromStdString(locationsText));
+    locationsLabel->setText(
+        QString::fromStdString(getLocationsText(locationLinks)));
   }
 
   locationsLabel->setVisible(showLocations);
@@ -171,7 +218,7 @@ void PluginCard::setContent(const PluginItem& plugin,
   if (plugin.cleaningUtility.has_value()) {
     auto cleanText =
         fmt::format(boost::locale::translate("Verified clean by {0}").str(),
-                    plugin.cleaningUtility.value());
+                    plugin.cleaningUtility.value().str());
     isCleanLabel->setToolTip(QString::fromStdString(cleanText));
   } else {
     isCleanLabel->setToolTip(QString());
@@ -198,6 +245,130 @@ void PluginCard::setSearchResult(bool isSearchResult,
 
 void PluginCard::refreshMessages() { messagesWidget->refresh(); }
 
+int PluginCard::estimateMinimumWidth(
+    const PluginItem& plugin,
+    const CardContentFiltersState& filters) const {
+  ensurePolished();
+
+  // Everything but the header can wrap, so the header's content determines
+  // the card's minimum width. The header's stretch doesn't get any spacing.
+  const auto margins = contentsMargins() + layout()->contentsMargins();
+  const auto spacing = layout()->itemAt(0)->layout()->spacing();
+
+  const auto crcText = plugin.crc.has_value() && !filters.hideCRCs
+                           ? crcToString(plugin.crc.value())
+                           : std::string();
+  const auto versionText =
+      plugin.version.has_value() && !filters.hideVersionNumbers
+          ? plugin.version.value()
+          : std::string();
+
+  auto width = getTextWidth(*nameLabel, QString::fromStdString(plugin.name)) +
+               getTextWidth(*crcLabel, QString::fromStdString(crcText)) +
+               getTextWidth(*versionLabel, QString::fromStdString(versionText)) +
+               2 * spacing;
+
+  const std::array<std::pair<const QLabel*, bool>, 7> icons{{
+      {isActiveLabel, plugin.isActive},
+      {masterFileLabel, plugin.isMaster},
+      {lightPluginLabel, plugin.isLightPlugin},
+      {emptyPluginLabel, plugin.isEmpty},
+      {loadsArchiveLabel, plugin.loadsArchive},
+      {isCleanLabel, plugin.cleaningUtility.has_value()},
+      {hasUserEditsLabel, plugin.hasUserMetadata},
+  }};
+
+  for (const auto& [label, isVisible] : icons) {
+    if (isVisible) {
+      width += spacing + label->sizeHint().width();
+    }
+  }
+
+  return width + margins.left() + margins.right();
+}
+
+int PluginCard::estimateHeightForWidth(
+    const QString& currentTagsText,
+    const QString& addTagsText,
+    const QString& removeTagsText,
+    const std::vector<std::string>& messageTexts,
+    const std::vector<std::string>& locationNames,
+    int width) const {
+  ensurePolished();
+
+  // Add up the heights of the sections that setContent() would show, using
+  // this card's fonts and margins but without changing its content.
+  const auto margins = contentsMargins() + layout()->contentsMargins();
+  const auto contentWidth = width - margins.left() - margins.right();
+  const auto spacing = layout()->spacing();
+
+  auto height = margins.top() + margins.bottom() +
+                layout()->itemAt(0)->minimumSize().height();
+
+  if (!messageTexts.empty()) {
+    height += spacing + messagesWidget->estimateHeightForWidth(messageTexts,
+                                                               contentWidth);
+  }
+
+  if (!currentTagsText.isEmpty() || !addTagsText.isEmpty() ||
+      !removeTagsText.isEmpty()) {
+    height += spacing + estimateTagsHeightForWidth(currentTagsText,
+                                                   addTagsText,
+                                                   removeTagsText,
+                                                   contentWidth);
+  }
+
+  if (!locationNames.empty()) {
+    const auto locationsText =
+        QString::fromStdString(getLocationsText(locationNames));
+    height += spacing + getWrappedMarkdownHeight(
+                            *locationsLabel, locationsText, contentWidth);
+  }
+
+  return height;
+}
+
+int PluginCard::estimateTagsHeightForWidth(const QString& currentTagsText,
+                                           const QString& addTagsText,
+                                           const QString& removeTagsText,
+                                           int width) const {
+  const auto tagsLayout = qobject_cast<QGridLayout*>(tagsGroupBox->layout());
+  const auto margins =
+      tagsGroupBox->contentsMargins() + tagsLayout->contentsMargins();
+
+  const std::array<std::tuple<const QLabel*, const QLabel*, const QString*>, 3>
+      rows{{
+          {currentTagsHeaderLabel, currentTagsLabel, &currentTagsText},
+          {addTagsHeaderLabel, addTagsLabel, &addTagsText},
+          {removeTagsHeaderLabel, removeTagsLabel, &removeTagsText},
+      }};
+
+  // Hidden rows don't contribute to the width of the header column.
+  int headerColumnWidth = 0;
+  for (const auto& [headerLabel, label, text] : rows) {
+    if (!text->isEmpty()) {
+      headerColumnWidth =
+          std::max(headerColumnWidth, headerLabel->sizeHint().width());
+    }
+  }
+
+  const auto textColumnWidth = width - margins.left() - margins.right() -
+                               headerColumnWidth -
+                               tagsLayout->horizontalSpacing();
+
+  auto height = margins.top() + margins.bottom();
+  int visibleRows = 0;
+  for (const auto& [headerLabel, label, text] : rows) {
+    if (!text->isEmpty()) {
+      height += std::max(headerLabel->sizeHint().height(),
+                         getWrappedTextHeight(*label, *text, textColumnWidth));
+      visibleRows += 1;
+    }
+  }
+
+  return height + tagsLayout->verticalSpacing() * (visibleRows - 1);
+}
+
 void PluginCard::setupUi() {
   crcLabel->setObjectName("plugin-crc");
   versionLabel->setObjectName("plugin-version");
@@ -35,7 +35,7 @@
 #include "gui/qt/messages_widget.h"
 
 namespace loot {
-QString getTagsText(const std::vector<std::string> tags, bool hideTags);
+QString getTagsText(const std::vector<InternedString>& tags, bool hideTags);
 
 std::vector<SourcedMessage> filterMessages(
     const PluginItem& plugin,
@@ -55,6 +55,19 @@ public:
 
   void refreshMessages();
 
+  // Estimate the card's size for the given content without changing the
+  // card's content, so that the sizes of many cards can be calculated using
+  // only one card.
+  int estimateMinimumWidth(const PluginItem& plugin,
+                           const CardContentFiltersState& filters) const;
+
+  int estimateHeightForWidth(const QString& currentTagsText,
+                             const QString& addTagsText,
+                             const QString& removeTagsText,
+                             const std::vector<std::string>& messageTexts,
+                             const std::vector<std::string>& locationNames,
+                             int width) const;
+
 private:
   QLabel* nameLabel{new QLabel(this)};
   QLabel* crcLabel{new QLabel(this)};
@@ -76,6 +89,11 @@ private:
   QLabel* locationsLabel{new QLabel(this)};
   MessagesWidget* messagesWidget{new MessagesWidget(this)};
 
+  int estimateTagsHeightForWidth(const QString& currentTagsText,
+                                 const QString& addTagsText,
+                                 const QString& removeTagsText,
+                                 int width) const;
+
   void setupUi();
 
   void translateUi();
@@ -25,30 +25,18 @@
 
 #include "gui/qt/plugin_item_filter_model.h"
 
+#include <algorithm>
+
 #include "gui/plugin_item.h"
 #include "gui/qt/plugin_item_model.h"
 
 namespace loot {
-bool anyMessagesVisible(const PluginItem& plugin,
-                        const CardContentFiltersState& filters) {
-  if (filters.hideAllPluginMessages) {
-    return false;
-  }
-
-  for (const auto& message : plugin.messages) {
-    if (!shouldFilterMessage(plugin.name, message, filters)) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
 PluginItemFilterModel::PluginItemFilterModel(QObject* parent) :
     QSortFilterProxyModel(parent) {}
 
 void PluginItemFilterModel::setFiltersState(PluginFiltersState&& state) {
   filterState = std::move(state);
+  areAcceptedPluginsStale = true;
 
   invalidateFilter();
 }
@@ -58,28 +46,68 @@ void PluginItemFilterModel::setFiltersState(
     std::vector<std::string>&& newConflictingPluginNames) {
   filterState = std::move(state);
   this->conflictingPluginNames = std::move(newConflictingPluginNames);
+  areAcceptedPluginsStale = true;
 
   invalidateFilter();
 }
 
 void PluginItemFilterModel::setSearchResults(QModelIndexList results) {
-  std::set<int> resultRows;
+  std::vector<bool> isResult(pluginItemModel().getPluginItems().size(), false);
   for (const auto& result : results) {
-    resultRows.insert(result.row());
-  }
-
-  for (int row = 1; row < rowCount(); row += 1) {
-    const auto index = this->index(row, PluginItemModel::CARDS_COLUMN);
-    const auto isNewResult = resultRows.find(row) != resultRows.end();
+    const auto sourceIndex = mapToSource(result);
 
-    // When setting new search results, there is no initial current result.
-    const SearchResultData newValue(isNewResult, false);
-    setData(index, QVariant::fromValue(newValue), SearchResultRole);
+    // Subtract 1 to skip the general information row.
+    if (sourceIndex.row() > 0) {
+      isResult.at(static_cast<size_t>(sourceIndex.row()) - 1) = true;
+    }
   }
+
+  pluginItemModel().setSearchResults(std::move(isResult));
 }
 
 void PluginItemFilterModel::clearSearchResults() { setSearchResults({}); }
 
+void PluginItemFilterModel::setSourceModel(QAbstractItemModel* newSourceModel) {
+  for (const auto& connection : sourceModelConnections) {
+    disconnect(connection);
+  }
+  sourceModelConnections.clear();
+
+  // Connect before the base class does so that the attribute table is updated
+  // before the base class checks which changed rows are accepted.
+  if (newSourceModel != nullptr) {
+    sourceModelConnections = {
+        connect(newSourceModel,
+                &QAbstractItemModel::dataChanged,
+                this,
+                &PluginItemFilterModel::onSourceDataChanged),
+        connect(newSourceModel,
+                &QAbstractItemModel::rowsInserted,
+                this,
+                &PluginItemFilterModel::onSourceRowsChanged),
+        connect(newSourceModel,
+                &QAbstractItemModel::rowsRemoved,
+                this,
+                &PluginItemFilterModel::onSourceRowsChanged),
+        connect(newSourceModel,
+                &QAbstractItemModel::rowsMoved,
+                this,
+                &PluginItemFilterModel::onSourceRowsChanged),
+        connect(newSourceModel,
+                &QAbstractItemModel::modelReset,
+                this,
+                &PluginItemFilterModel::onSourceRowsChanged),
+        connect(newSourceModel,
+                &QAbstractItemModel::layoutChanged,
+                this,
+                &PluginItemFilterModel::onSourceRowsChanged)};
+  }
+
+  isAttributeTableStale = true;
+
+  QSortFilterProxyModel::setSourceModel(newSourceModel);
+}
+
 bool PluginItemFilterModel::filterAcceptsRow(
     int sourceRow,
     const QModelIndex& sourceParent) const {
@@ -88,36 +116,21 @@ bool PluginItemFilterModel::filterAcceptsRow(
     return true;
   }
 
-  const auto sourceIndex = sourceModel()->index(
-      sourceRow, PluginItemModel::CARDS_COLUMN, sourceParent);
-
-  auto item = sourceIndex.data(RawDataRole).value<PluginItem>();
-  auto contentFilters =
-      sourceIndex.data(CardContentFiltersRole).value<CardContentFiltersState>();
-
-  if (filterState.hideInactivePlugins && !item.isActive) {
-    return false;
-  }
-
-  if (filterState.hideMessagelessPlugins &&
-      !anyMessagesVisible(item, contentFilters)) {
-    return false;
-  }
+  updateAcceptedPlugins();
 
-  if (filterState.hideCreationClubPlugins && item.isCreationClubPlugin) {
-    return false;
-  }
+  // Subtract 1 to skip the general information row.
+  return acceptedPlugins.test(static_cast<size_t>(sourceRow) - 1);
+}
 
-  if (filterState.showOnlyEmptyPlugins && !item.isEmpty) {
-    return false;
-  }
+PluginItemModel& PluginItemFilterModel::pluginItemModel() {
+  return *static_cast<PluginItemModel*>(sourceModel());
+}
 
-  if (filterState.groupName.has_value() &&
-      item.group.value_or(Group::DEFAULT_NAME) !=
-          filterState.groupName.value()) {
-    return false;
-  }
+const PluginItemModel& PluginItemFilterModel::pluginItemModel() const {
+  return *static_cast<const PluginItemModel*>(sourceModel());
+}
 
+bool PluginItemFilterModel::isContentAccepted(const PluginItem& item) const {
   if (std::holds_alternative<std::string>(filterState.content) &&
       !item.containsText(std::get<std::string>(filterState.content))) {
     return false;
@@ -141,4 +154,69 @@ bool PluginItemFilterModel::filterAcceptsRow(
 
   return true;
 }
+
+void PluginItemFilterModel::updateAcceptedPlugins() const {
+  const auto& items = pluginItemModel().getPluginItems();
+
+  if (isAttributeTableStale) {
+    attributeTable.assign(items,
+                          pluginItemModel().getCardContentFiltersState());
+    isAttributeTableStale = false;
+    areAcceptedPluginsStale = true;
+  }
+
+  if (!areAcceptedPluginsStale) {
+    return;
+  }
+
+  acceptedPlugins = attributeTable.getAcceptedPlugins(filterState);
+
+  // The content and conflicts filters can't be applied column-wise, so check
+  // them only for the plugins that passed the other filters.
+  const auto hasContentFilters =
+      !std::holds_alternative<std::monostate>(filterState.content) ||
+      filterState.conflictsPluginName.has_value();
+  if (hasContentFilters) {
+    for (size_t i = 0; i < items.size(); i += 1) {
+      if (acceptedPlugins.test(i) && !isContentAccepted(items[i])) {
+        acceptedPlugins.set(i, false);
+      }
+    }
+  }
+
+  areAcceptedPluginsStale = false;
+}
+
+void PluginItemFilterModel::onSourceDataChanged(const QModelIndex& topLeft,
+                                                const QModelIndex& bottomRight,
+                                                const QList<int>& roles) {
+  if (roles.contains(CardContentFiltersRole)) {
+    isAttributeTableStale = true;
+    return;
+  }
+
+  const auto rawDataChanged = roles.isEmpty() || roles.contains(RawDataRole);
+  if (isAttributeTableStale || !rawDataChanged) {
+    return;
+  }
+
+  // Update only the changed plugins' attributes.
+  const auto& items = pluginItemModel().getPluginItems();
+  const auto& contentFilters = pluginItemModel().getCardContentFiltersState();
+  for (int row = std::max(topLeft.row(), 1); row <= bottomRight.row();
+       row += 1) {
+    const auto index = static_cast<size_t>(row) - 1;
+    attributeTable.update(index, items.at(index), contentFilters);
+
+    if (!areAcceptedPluginsStale) {
+      acceptedPlugins.set(index,
+                          attributeTable.isAccepted(index, filterState) &&
+                              isContentAccepted(items.at(index)));
+    }
+  }
+}
+
+void PluginItemFilterModel::onSourceRowsChanged() {
+  isAttributeTableStale = true;
+}
 }
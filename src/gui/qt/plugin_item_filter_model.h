@@ -29,8 +29,11 @@
 #include <QtCore/QSortFilterProxyModel>
 
 #include "gui/qt/filters_states.h"
+#include "gui/qt/plugin_attribute_table.h"
 
 namespace loot {
+class PluginItemModel;
+
 class PluginItemFilterModel : public QSortFilterProxyModel {
   Q_OBJECT
 public:
@@ -43,13 +46,33 @@ public:
   void setSearchResults(QModelIndexList results);
   void clearSearchResults();
 
+  void setSourceModel(QAbstractItemModel* sourceModel) override;
+
 protected:
   bool filterAcceptsRow(int sourceRow,
                         const QModelIndex& sourceParent) const override;
 
 private:
+  PluginItemModel& pluginItemModel();
+  const PluginItemModel& pluginItemModel() const;
+  bool isContentAccepted(const PluginItem& item) const;
+  void updateAcceptedPlugins() const;
+
+  void onSourceDataChanged(const QModelIndex& topLeft,
+                           const QModelIndex& bottomRight,
+                           const QList<int>& roles);
+  void onSourceRowsChanged();
+
   PluginFiltersState filterState;
   std::vector<std::string> conflictingPluginNames;
+  std::vector<QMetaObject::Connection> sourceModelConnections;
+
+  // The table and accepted plugins are updated lazily because the proxy model
+  // asks whether rows are accepted while it handles source model changes.
+  mutable PluginAttributeTable attributeTable;
+  mutable PluginBitset acceptedPlugins;
+  mutable bool isAttributeTableStale{true};
+  mutable bool areAcceptedPluginsStale{true};
 };
 }
 
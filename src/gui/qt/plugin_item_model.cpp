@@ -27,9 +27,12 @@
 
 #include <QtCore/QMimeData>
 #include <QtCore/QSize>
+#include <algorithm>
+#include <iterator>
 
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
+#include "gui/sequence_diff.h"
 
 namespace loot {
 SearchResultData::SearchResultData(bool isResult, bool isCurrentResult) :
@@ -74,6 +77,10 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
     return QVariant::fromValue(items.at(itemsIndex));
   }
 
+  if (role == CardFingerprintRole) {
+    return QVariant::fromValue(getCardFingerprint(index.row()));
+  }
+
   if (index.row() == 0) {
     if (index.column() == CARDS_COLUMN && role == CountersRole) {
       const auto counters =
@@ -282,6 +289,7 @@ bool PluginItemModel::setData(const QModelIndex& index,
     const int itemsIndex = index.row() - 1;
 
     items.at(itemsIndex) = value.value<PluginItem>();
+    cardFingerprints.at(itemsIndex) = std::nullopt;
   }
 
   // The RawDataRole data changed, emit dataChanged for all columns.
@@ -324,20 +332,114 @@ std::unordered_map<std::string, int> PluginItemModel::getPluginNameToRowMap()
 }
 
 void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
-  beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
+  std::vector<std::string> newNames;
+  for (const auto& item : newItems) {
+    newNames.push_back(item.name);
+  }
 
-  items.clear();
-  searchResults.clear();
-  currentSearchResultIndex = std::nullopt;
+  const auto diff = DiffSequences(getPluginNames(), newNames);
+  if (!diff.has_value() || diff.value().moved.size() > MAX_INCREMENTAL_MOVES) {
+    replacePluginItems(std::move(newItems));
+    return;
+  }
 
-  endRemoveRows();
+  std::vector<bool> isInserted(newItems.size(), false);
+  for (const auto index : diff.value().inserted) {
+    isInserted.at(index) = true;
+  }
 
-  beginInsertRows(QModelIndex(), 1, static_cast<int>(newItems.size()));
+  // The current search result's index may change, so forget it while rows
+  // are being changed and find it again afterwards.
+  std::optional<std::string> currentSearchResultName;
+  if (currentSearchResultIndex.has_value()) {
+    currentSearchResultName = items.at(currentSearchResultIndex.value()).name;
+    currentSearchResultIndex = std::nullopt;
+  }
 
-  std::swap(items, newItems);
-  searchResults.resize(items.size(), false);
+  removePluginItems(diff.value().removed);
+  movePluginItems(diff.value().moved, newNames, isInserted);
+  insertPluginItems(diff.value().inserted, newItems);
+
+  // Now the items are for the same plugins in the same order, so just replace
+  // the items that have changed, signalling each run of changed rows
+  // separately so that unchanged rows between them aren't repainted.
+  std::optional<int> changedRunStart;
+  for (size_t i = 0; i <= items.size(); i += 1) {
+    const auto hasChanged = i < items.size() && !isInserted.at(i) &&
+                            items.at(i) != newItems.at(i);
+
+    if (hasChanged) {
+      items.at(i) = std::move(newItems.at(i));
+      cardFingerprints.at(i) = std::nullopt;
+    }
 
-  endInsertRows();
+    if (hasChanged && !changedRunStart.has_value()) {
+      changedRunStart = static_cast<int>(i);
+    } else if (!hasChanged && changedRunStart.has_value()) {
+      // Add 1 to skip the general information row.
+      const auto topLeft = index(changedRunStart.value() + 1, 0);
+      const auto bottomRight = index(static_cast<int>(i), columnCount() - 1);
+      emit dataChanged(topLeft, bottomRight, {RawDataRole});
+
+      changedRunStart = std::nullopt;
+    }
+  }
+
+  if (currentSearchResultName.has_value()) {
+    const auto it = std::find_if(
+        items.begin(), items.end(), [&](const PluginItem& item) {
+          return item.name == currentSearchResultName.value();
+        });
+
+    if (it != items.end()) {
+      const auto searchResultsIndex =
+          static_cast<int>(std::distance(items.begin(), it));
+      currentSearchResultIndex = searchResultsIndex;
+
+      const auto resultIndex = index(searchResultsIndex + 1, CARDS_COLUMN);
+      emit dataChanged(resultIndex, resultIndex, {SearchResultRole});
+    }
+  }
+}
+
+void PluginItemModel::updatePluginItems(
+    std::vector<PluginItem>&& changedItems) {
+  std::unordered_map<std::string, size_t> changedItemIndices;
+  changedItemIndices.reserve(changedItems.size());
+  for (size_t i = 0; i < changedItems.size(); i += 1) {
+    changedItemIndices.emplace(changedItems.at(i).name, i);
+  }
+
+  std::optional<int> firstChangedRow;
+  int lastChangedRow = 0;
+  for (size_t i = 0; i < items.size(); i += 1) {
+    const auto it = changedItemIndices.find(items.at(i).name);
+    if (it == changedItemIndices.end()) {
+      continue;
+    }
+
+    auto& changedItem = changedItems.at(it->second);
+    if (items.at(i) == changedItem) {
+      continue;
+    }
+
+    items.at(i) = std::move(changedItem);
+    cardFingerprints.at(i) = std::nullopt;
+
+    // Add 1 to skip the general information row.
+    const auto row = static_cast<int>(i) + 1;
+    if (!firstChangedRow.has_value()) {
+      firstChangedRow = row;
+    }
+    lastChangedRow = row;
+  }
+
+  if (firstChangedRow.has_value()) {
+    const auto topLeft = index(firstChangedRow.value(), 0);
+    const auto bottomRight = index(lastChangedRow, columnCount() - 1);
+
+    emit dataChanged(topLeft, bottomRight, {RawDataRole});
+  }
 }
 
 void PluginItemModel::setEditorPluginName(
@@ -390,15 +492,50 @@ const GeneralInformation& PluginItemModel::getGeneralInfo() const {
   return generalInformation;
 }
 
+const CardContentFiltersState& PluginItemModel::getCardContentFiltersState()
+    const {
+  return cardContentFiltersState;
+}
+
 void PluginItemModel::setCardContentFiltersState(
     CardContentFiltersState&& state) {
   cardContentFiltersState = std::move(state);
+  cardFingerprints.assign(items.size(), std::nullopt);
 
   const auto startIndex = index(1, CARDS_COLUMN);
   const auto endIndex = index(rowCount() - 1, CARDS_COLUMN);
   emit dataChanged(startIndex, endIndex, {CardContentFiltersRole});
 }
 
+void PluginItemModel::setSearchResults(std::vector<bool>&& newSearchResults) {
+  newSearchResults.resize(items.size(), false);
+
+  const auto previousCurrentResultIndex = currentSearchResultIndex;
+  currentSearchResultIndex = std::nullopt;
+
+  std::swap(searchResults, newSearchResults);
+
+  // newSearchResults now holds the previous search results.
+  std::optional<int> changedRunStart;
+  for (size_t i = 0; i <= searchResults.size(); i += 1) {
+    const auto hasChanged =
+        i < searchResults.size() &&
+        (searchResults[i] != newSearchResults[i] ||
+         previousCurrentResultIndex == static_cast<int>(i));
+
+    if (hasChanged && !changedRunStart.has_value()) {
+      changedRunStart = static_cast<int>(i);
+    } else if (!hasChanged && changedRunStart.has_value()) {
+      // Add 1 to skip the general information row.
+      const auto startIndex = index(changedRunStart.value() + 1, CARDS_COLUMN);
+      const auto endIndex = index(static_cast<int>(i), CARDS_COLUMN);
+      emit dataChanged(startIndex, endIndex, {SearchResultRole});
+
+      changedRunStart = std::nullopt;
+    }
+  }
+}
+
 QModelIndex PluginItemModel::setCurrentSearchResult(size_t resultIndex) {
   size_t currentResultIndex = 0;
   for (size_t i = 0; i < searchResults.size(); i += 1) {
@@ -420,4 +557,161 @@ QModelIndex PluginItemModel::setCurrentSearchResult(size_t resultIndex) {
 
   return QModelIndex();
 }
+
+void PluginItemModel::replacePluginItems(std::vector<PluginItem>&& newItems) {
+  beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
+
+  items.clear();
+  searchResults.clear();
+  cardFingerprints.clear();
+  currentSearchResultIndex = std::nullopt;
+
+  endRemoveRows();
+
+  beginInsertRows(QModelIndex(), 1, static_cast<int>(newItems.size()));
+
+  std::swap(items, newItems);
+  searchResults.resize(items.size(), false);
+  cardFingerprints.resize(items.size());
+
+  endInsertRows();
+}
+
+void PluginItemModel::removePluginItems(const std::vector<size_t>& indices) {
+  // Remove contiguous runs of items, starting from the end so that the
+  // indices of the items that are yet to be removed don't change.
+  auto it = indices.rbegin();
+  while (it != indices.rend()) {
+    const auto last = *it;
+    auto first = last;
+    ++it;
+    while (it != indices.rend() && *it + 1 == first) {
+      first = *it;
+      ++it;
+    }
+
+    // Add 1 to skip the general information row.
+    beginRemoveRows(QModelIndex(),
+                    static_cast<int>(first) + 1,
+                    static_cast<int>(last) + 1);
+
+    items.erase(items.begin() + first, items.begin() + last + 1);
+    searchResults.erase(searchResults.begin() + first,
+                        searchResults.begin() + last + 1);
+    cardFingerprints.erase(cardFingerprints.begin() + first,
+                           cardFingerprints.begin() + last + 1);
+
+    endRemoveRows();
+  }
+}
+
+void PluginItemModel::movePluginItems(const std::vector<size_t>& newIndices,
+                                      const std::vector<std::string>& newNames,
+                                      const std::vector<bool>& isInserted) {
+  for (const auto newIndex : newIndices) {
+    const auto source = getPluginItemIndex(newNames.at(newIndex));
+
+    // Move the item to just after the item that precedes it in the new order,
+    // ignoring any items that have yet to be inserted. As items are moved in
+    // their new order, the preceding item is already in the right place.
+    size_t destination = 0;
+    for (auto i = newIndex; i > 0; i -= 1) {
+      if (!isInserted.at(i - 1)) {
+        destination = getPluginItemIndex(newNames.at(i - 1)) + 1;
+        break;
+      }
+    }
+
+    if (destination == source || destination == source + 1) {
+      continue;
+    }
+
+    // Add 1 to skip the general information row.
+    beginMoveRows(QModelIndex(),
+                  static_cast<int>(source) + 1,
+                  static_cast<int>(source) + 1,
+                  QModelIndex(),
+                  static_cast<int>(destination) + 1);
+
+    if (source < destination) {
+      std::rotate(items.begin() + source,
+                  items.begin() + source + 1,
+                  items.begin() + destination);
+      std::rotate(searchResults.begin() + source,
+                  searchResults.begin() + source + 1,
+                  searchResults.begin() + destination);
+      std::rotate(cardFingerprints.begin() + source,
+                  cardFingerprints.begin() + source + 1,
+                  cardFingerprints.begin() + destination);
+    } else {
+      std::rotate(items.begin() + destination,
+                  items.begin() + source,
+                  items.begin() + source + 1);
+      std::rotate(searchResults.begin() + destination,
+                  searchResults.begin() + source,
+                  searchResults.begin() + source + 1);
+      std::rotate(cardFingerprints.begin() + destination,
+                  cardFingerprints.begin() + source,
+                  cardFingerprints.begin() + source + 1);
+    }
+
+    endMoveRows();
+  }
+}
+
+void PluginItemModel::insertPluginItems(const std::vector<size_t>& newIndices,
+                                        std::vector<PluginItem>& newItems) {
+  // Insert contiguous runs of items in their new order, so that each run's
+  // new indices are also the indices to insert them at.
+  size_t i = 0;
+  while (i < newIndices.size()) {
+    const auto first = newIndices.at(i);
+    auto last = first;
+    i += 1;
+    while (i < newIndices.size() && newIndices.at(i) == last + 1) {
+      last = newIndices.at(i);
+      i += 1;
+    }
+
+    // Add 1 to skip the general information row.
+    beginInsertRows(QModelIndex(),
+                    static_cast<int>(first) + 1,
+                    static_cast<int>(last) + 1);
+
+    items.insert(items.begin() + first,
+                 std::make_move_iterator(newItems.begin() + first),
+                 std::make_move_iterator(newItems.begin() + last + 1));
+    searchResults.insert(
+        searchResults.begin() + first, last - first + 1, false);
+    cardFingerprints.insert(
+        cardFingerprints.begin() + first, last - first + 1, std::nullopt);
+
+    endInsertRows();
+  }
+}
+
+size_t PluginItemModel::getPluginItemIndex(const std::string& name) const {
+  const auto it =
+      std::find_if(items.begin(), items.end(), [&](const PluginItem& item) {
+        return item.name == name;
+      });
+
+  return static_cast<size_t>(std::distance(items.begin(), it));
+}
+
+CardFingerprint PluginItemModel::getCardFingerprint(int row) const {
+  if (row == 0) {
+    const auto counters =
+        GeneralInformationCounters(generalInformation.generalMessages, items);
+    return loot::getCardFingerprint(generalInformation, counters);
+  }
+
+  auto& fingerprint = cardFingerprints.at(row - 1);
+  if (!fingerprint.has_value()) {
+    fingerprint =
+        loot::getCardFingerprint(items.at(row - 1), cardContentFiltersState);
+  }
+
+  return fingerprint.value();
+}
 }
@@ -29,6 +29,7 @@
 #include <QtCore/QAbstractListModel>
 
 #include "gui/plugin_item.h"
+#include "gui/qt/card_fingerprint.h"
 #include "gui/qt/counters.h"
 #include "gui/qt/filters_states.h"
 #include "gui/qt/general_info.h"
@@ -44,6 +45,7 @@ static constexpr int CardContentFiltersRole = Qt::UserRole + 5;
 static constexpr int ContentSearchRole = Qt::UserRole + 6;
 static constexpr int DragRole = Qt::UserRole + 7;
 static constexpr int SearchResultRole = Qt::UserRole + 8;
+static constexpr int CardFingerprintRole = Qt::UserRole + 9;
 
 struct SearchResultData {
   SearchResultData() = default;
@@ -91,8 +93,16 @@ public:
 
   std::unordered_map<std::string, int> getPluginNameToRowMap() const;
 
+  // Rows are removed, moved and inserted individually so that views keep
+  // their state, and only rows with items that differ are updated. If too
+  // many rows would move, all rows are replaced instead.
   void setPluginItems(std::vector<PluginItem>&& items);
 
+  // Replaces the items for the same plugins as the given items, emitting a
+  // single dataChanged signal for all the rows that changed. Items for
+  // plugins that aren't in the model are ignored.
+  void updatePluginItems(std::vector<PluginItem>&& changedItems);
+
   void setEditorPluginName(const std::optional<std::string>& editorPluginName);
 
   void setGeneralInformation(bool gameSupportsLightPlugins,
@@ -108,15 +118,37 @@ public:
 
   const GeneralInformation& getGeneralInfo() const;
 
+  const CardContentFiltersState& getCardContentFiltersState() const;
+
   void setCardContentFiltersState(CardContentFiltersState&& state);
 
+  // Replaces all the search results at once, taking a flag for each plugin
+  // item, and unsets the current search result. A dataChanged signal is
+  // emitted for each run of consecutive rows that changed.
+  void setSearchResults(std::vector<bool>&& newSearchResults);
+
   QModelIndex setCurrentSearchResult(size_t resultIndex);
 
 private:
+  static constexpr size_t MAX_INCREMENTAL_MOVES = 100;
+
+  void replacePluginItems(std::vector<PluginItem>&& newItems);
+  void removePluginItems(const std::vector<size_t>& indices);
+  void movePluginItems(const std::vector<size_t>& newIndices,
+                       const std::vector<std::string>& newNames,
+                       const std::vector<bool>& isInserted);
+  void insertPluginItems(const std::vector<size_t>& newIndices,
+                         std::vector<PluginItem>& newItems);
+  size_t getPluginItemIndex(const std::string& name) const;
+  CardFingerprint getCardFingerprint(int row) const;
+
   GeneralInformation generalInformation;
   std::vector<PluginItem> items;
   std::vector<bool> searchResults;
   std::optional<int> currentSearchResultIndex;
+  // Fingerprints are calculated when first needed, and are discarded when
+  // their items or the card content filters change.
+  mutable std::vector<std::optional<CardFingerprint>> cardFingerprints;
 
   std::optional<std::string> currentEditorPluginName;
   CardContentFiltersState cardContentFiltersState;
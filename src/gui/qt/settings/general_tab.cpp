@@ -86,6 +86,9 @@ void GeneralTab::initialiseInputs(const LootSettings& settings,
   loggingCheckbox->setChecked(settings.isDebugLoggingEnabled());
   useNoSortingChangesDialogCheckbox->setChecked(
       settings.isNoSortingChangesDialogEnabled());
+  useIncrementalBackupsCheckbox->setChecked(
+      settings.isIncrementalBackupEnabled());
+  watchGameFilesCheckbox->setChecked(settings.isGameFilesWatchingEnabled());
 
   preludeSourceInput->setText(
       QString::fromStdString(settings.getPreludeSource()));
@@ -102,6 +105,9 @@ void GeneralTab::recordInputValues(LootSettings& settings) {
   const auto enableDebugLogging = loggingCheckbox->isChecked();
   const auto enableNoSortingChangesDialog =
       useNoSortingChangesDialogCheckbox->isChecked();
+  const auto enableIncrementalBackup =
+      useIncrementalBackupsCheckbox->isChecked();
+  const auto enableGameFilesWatching = watchGameFilesCheckbox->isChecked();
   auto preludeSource = preludeSourceInput->text().toStdString();
 
   settings.setDefaultGame(defaultGame);
@@ -111,6 +117,8 @@ void GeneralTab::recordInputValues(LootSettings& settings) {
   settings.enableLootUpdateCheck(checkForUpdates);
   settings.enableDebugLogging(enableDebugLogging);
   settings.enableNoSortingChangesDialog(enableNoSortingChangesDialog);
+  settings.enableIncrementalBackup(enableIncrementalBackup);
+  settings.enableGameFilesWatching(enableGameFilesWatching);
   settings.setPreludeSource(preludeSource);
 }
 
@@ -141,6 +149,9 @@ void GeneralTab::setupUi() {
   generalLayout->addRow(loggingLabel, loggingCheckbox);
   generalLayout->addRow(useNoSortingChangesDialogLabel,
                         useNoSortingChangesDialogCheckbox);
+  generalLayout->addRow(useIncrementalBackupsLabel,
+                        useIncrementalBackupsCheckbox);
+  generalLayout->addRow(watchGameFilesLabel, watchGameFilesCheckbox);
   generalLayout->addRow(preludeSourceLabel, preludeSourceInput);
   generalLayout->addItem(spacer);
   generalLayout->addRow(descriptionLabel);
@@ -158,9 +169,18 @@ void GeneralTab::translateUi() {
   preludeSourceLabel->setText(translate("Masterlist prelude source"));
   useNoSortingChangesDialogLabel->setText(
       translate("Display dialog when sorting makes no changes"));
+  useIncrementalBackupsLabel->setText(translate("Use incremental backups"));
+  watchGameFilesLabel->setText(
+      translate("Refresh content when the game's plugins change"));
 
   loggingLabel->setToolTip(
       translate("The output is logged to the LOOTDebugLog.txt file."));
+  useIncrementalBackupsLabel->setToolTip(
+      translate("Backups only store files that have changed since the "
+                "previous backup, instead of a full zip file each time."));
+  watchGameFilesLabel->setToolTip(
+      translate("Watches the game's plugins, BashTags files and load order "
+                "for changes, and updates only the affected plugins."));
 
   preludeSourceInput->setToolTip(translate("A prelude source is required."));
 
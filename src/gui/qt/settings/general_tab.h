@@ -54,6 +54,8 @@ private:
   QLabel *checkUpdatesLabel{new QLabel(this)};
   QLabel *loggingLabel{new QLabel(this)};
   QLabel *useNoSortingChangesDialogLabel{new QLabel(this)};
+  QLabel *useIncrementalBackupsLabel{new QLabel(this)};
+  QLabel *watchGameFilesLabel{new QLabel(this)};
   QLabel *preludeSourceLabel{new QLabel(this)};
   QComboBox *defaultGameComboBox{new QComboBox(this)};
   QComboBox *languageComboBox{new QComboBox(this)};
@@ -62,6 +64,8 @@ private:
   QCheckBox *checkUpdatesCheckbox{new QCheckBox(this)};
   QCheckBox *loggingCheckbox{new QCheckBox(this)};
   QCheckBox *useNoSortingChangesDialogCheckbox{new QCheckBox(this)};
+  QCheckBox *useIncrementalBackupsCheckbox{new QCheckBox(this)};
+  QCheckBox *watchGameFilesCheckbox{new QCheckBox(this)};
   QLineEdit *preludeSourceInput{new QLineEdit(this)};
   QLabel *descriptionLabel{new QLabel(this)};
 
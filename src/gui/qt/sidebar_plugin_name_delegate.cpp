@@ -97,7 +97,7 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
     }
 
     auto group = painter->fontMetrics().elidedText(
-        QString::fromStdString(pluginItem.group.value()),
+        QString::fromStdString(pluginItem.group.value().str()),
         Qt::ElideRight,
         groupRect.width());
     painter->drawText(groupRect, Qt::AlignLeft, group);
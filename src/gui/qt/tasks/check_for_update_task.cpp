@@ -89,14 +89,11 @@ std::optional<QDate> getDateFromCommitJson(const QJsonDocument &document,
   return QDate::fromString(dateString, Qt::ISODate);
 }
 
+CheckForUpdateTask::CheckForUpdateTask(NetworkSession &networkSession) :
+    NetworkTask(networkSession) {}
+
 void CheckForUpdateTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     // Reset the tag commit date in case this task is being run twice somehow.
     tagCommitDate = std::nullopt;
 
@@ -109,21 +106,17 @@ void CheckForUpdateTask::execute() {
 
 void CheckForUpdateTask::sendHttpRequest(
     const std::string &url,
-    void (CheckForUpdateTask::*onFinished)()) {
+    void (CheckForUpdateTask::*onFinished)(const NetworkResponse &)) {
   QNetworkRequest request(QUrl(QString::fromStdString(url)));
   request.setRawHeader("Accept", "application/vnd.github.v3+json");
-  const auto reply = networkAccessManager->get(request);
-
-  connect(reply, &QNetworkReply::finished, this, onFinished);
-  connect(reply,
-          &QNetworkReply::errorOccurred,
-          this,
-          &CheckForUpdateTask::onNetworkError);
-  connect(
-      reply, &QNetworkReply::sslErrors, this, &CheckForUpdateTask::onSSLError);
+
+  get(request, [this, onFinished](const NetworkResponse &response) {
+    (this->*onFinished)(response);
+  });
 }
 
-void CheckForUpdateTask::onGetLatestReleaseReplyFinished() {
+void CheckForUpdateTask::onGetLatestReleaseReplyFinished(
+    const NetworkResponse &response) {
   try {
     const auto logger = getLogger();
     if (logger) {
@@ -131,11 +124,9 @@ void CheckForUpdateTask::onGetLatestReleaseReplyFinished() {
           "Finished receiving a response for getting the latest release's tag");
     }
 
-    const auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto responseData = readResponse(response, "No response data");
 
     if (!responseData.has_value()) {
-      emit error("No response data");
       return;
     }
 
@@ -164,7 +155,8 @@ void CheckForUpdateTask::onGetLatestReleaseReplyFinished() {
   }
 }
 
-void CheckForUpdateTask::onGetTagCommitReplyFinished() {
+void CheckForUpdateTask::onGetTagCommitReplyFinished(
+    const NetworkResponse &response) {
   try {
     const auto logger = getLogger();
     if (logger) {
@@ -173,11 +165,9 @@ void CheckForUpdateTask::onGetTagCommitReplyFinished() {
           "commit");
     }
 
-    const auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto responseData = readResponse(response, "No response data");
 
     if (!responseData.has_value()) {
-      emit error("No response data");
       return;
     }
 
@@ -206,7 +196,8 @@ void CheckForUpdateTask::onGetTagCommitReplyFinished() {
   }
 }
 
-void CheckForUpdateTask::onGetBuildCommitReplyFinished() {
+void CheckForUpdateTask::onGetBuildCommitReplyFinished(
+    const NetworkResponse &response) {
   try {
     const auto logger = getLogger();
     if (logger) {
@@ -220,11 +211,9 @@ void CheckForUpdateTask::onGetBuildCommitReplyFinished() {
       return;
     }
 
-    const auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto responseData = readResponse(response, "No response data");
 
     if (!responseData.has_value()) {
-      emit error("No response data");
       return;
     }
 
@@ -26,27 +26,27 @@
 #ifndef LOOT_GUI_QT_TASKS_CHECK_FOR_UPDATE_TASK
 #define LOOT_GUI_QT_TASKS_CHECK_FOR_UPDATE_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
-
 #include "gui/qt/tasks/network_task.h"
 
 namespace loot {
 class CheckForUpdateTask : public NetworkTask {
   Q_OBJECT
+public:
+  explicit CheckForUpdateTask(NetworkSession &networkSession);
+
 public slots:
   void execute() override;
 
 private:
-  QNetworkAccessManager *networkAccessManager{nullptr};
   std::optional<QDate> tagCommitDate;
 
-  void sendHttpRequest(const std::string &url,
-                       void (CheckForUpdateTask::*onFinished)());
+  void sendHttpRequest(
+      const std::string &url,
+      void (CheckForUpdateTask::*onFinished)(const NetworkResponse &));
 
-private slots:
-  void onGetLatestReleaseReplyFinished();
-  void onGetTagCommitReplyFinished();
-  void onGetBuildCommitReplyFinished();
+  void onGetLatestReleaseReplyFinished(const NetworkResponse &response);
+  void onGetTagCommitReplyFinished(const NetworkResponse &response);
+  void onGetBuildCommitReplyFinished(const NetworkResponse &response);
 };
 }
 
@@ -28,6 +28,29 @@
 #include <boost/locale.hpp>
 
 namespace loot {
+NetworkTask::NetworkTask(NetworkSession &networkSession) :
+    networkSession(&networkSession) {}
+
+void NetworkTask::get(const QNetworkRequest &request,
+                      std::function<void(const NetworkResponse &)> onResponse) {
+  networkSession->get(request, this, std::move(onResponse));
+}
+
+std::optional<QByteArray> NetworkTask::readResponse(
+    const NetworkResponse &response,
+    const std::string &statusError) {
+  if (response.error.has_value()) {
+    emit error(response.error.value());
+    return std::nullopt;
+  }
+
+  if (!response.data.has_value()) {
+    emit error(statusError);
+  }
+
+  return response.data;
+}
+
 void NetworkTask::handleException(const std::exception &exception) {
   const auto logger = getLogger();
   if (logger) {
@@ -42,46 +65,4 @@ void NetworkTask::handleException(const std::exception &exception) {
 
   emit this->error(message);
 }
-
-void NetworkTask::onNetworkError(QNetworkReply::NetworkError networkError) {
-  try {
-    const auto reply = qobject_cast<QIODevice *>(sender());
-    const auto errorString = reply->errorString().toStdString();
-
-    const auto logger = getLogger();
-    if (logger) {
-      logger->error("Network error code {}, description is: {}",
-                    networkError,
-                    errorString);
-    }
-
-    emit error(errorString);
-  } catch (const std::exception &e) {
-    handleException(e);
-  }
-}
-
-void NetworkTask::onSSLError(const QList<QSslError> &errors) {
-  try {
-    const auto logger = getLogger();
-
-    std::string errorStrings;
-    for (const auto &error : errors) {
-      const auto errorString = error.errorString().toStdString();
-      errorStrings += errorString + "; ";
-
-      if (logger) {
-        logger->error("SSL error: {}", errorString);
-      }
-    }
-
-    if (!errorStrings.empty()) {
-      errorStrings = errorStrings.substr(0, errorStrings.length() - 2);
-    }
-
-    emit error(errorStrings);
-  } catch (const std::exception &e) {
-    handleException(e);
-  }
-}
 }
@@ -26,19 +26,32 @@
 #ifndef LOOT_GUI_QT_TASKS_NETWORK_TASK
 #define LOOT_GUI_QT_TASKS_NETWORK_TASK
 
-#include <QtNetwork/QNetworkReply>
+#include <functional>
 
+#include "gui/qt/network_session.h"
 #include "gui/qt/tasks/tasks.h"
 
 namespace loot {
 class NetworkTask : public Task {
   Q_OBJECT
+public:
+  explicit NetworkTask(NetworkSession &networkSession);
+
 protected:
+  // Sends the request through the network session. The callback is run in
+  // this task's thread.
+  void get(const QNetworkRequest &request,
+           std::function<void(const NetworkResponse &)> onResponse);
+
+  // Emits an error and returns nothing if the request failed, using the given
+  // message if it failed because of its HTTP status code.
+  std::optional<QByteArray> readResponse(const NetworkResponse &response,
+                                         const std::string &statusError);
+
   void handleException(const std::exception &exception);
 
-protected slots:
-  void onNetworkError(QNetworkReply::NetworkError error);
-  void onSSLError(const QList<QSslError> &errors);
+private:
+  NetworkSession *networkSession;
 };
 }
 
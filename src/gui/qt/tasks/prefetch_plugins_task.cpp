@@ -0,0 +1,107 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/tasks/prefetch_plugins_task.h"
+
+#include "gui/state/logging.h"
+
+namespace loot {
+PrefetchPluginsTask::PrefetchPluginsTask(QObject* parent) : QObject(parent) {}
+
+PrefetchPluginsTask::~PrefetchPluginsTask() {
+  if (thread != nullptr) {
+    // The thread stops after loading its current batch of plugins, and must
+    // not outlive the application, so wait for it.
+    cancel();
+    thread->wait();
+    delete thread;
+  }
+}
+
+void PrefetchPluginsTask::start(const gui::Game& game) {
+  if (isRunning()) {
+    return;
+  }
+
+  // The thread owns shared copies of its state so that a cancelled thread
+  // can't interfere with a later one.
+  isCancelled = std::make_shared<std::atomic<bool>>(false);
+  threadResult = std::make_shared<std::optional<gui::PrefetchedPlugins>>();
+
+  thread = QThread::create([prefetcher = game.CreatePluginsPrefetcher(),
+                            isCancelled = isCancelled,
+                            threadResult = threadResult]() {
+    try {
+      *threadResult = prefetcher(*isCancelled);
+    } catch (const std::exception& e) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to prefetch plugins: {}", e.what());
+      }
+    }
+  });
+
+  connect(thread,
+          &QThread::finished,
+          this,
+          &PrefetchPluginsTask::onThreadFinished);
+  connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+  thread->setObjectName("prefetchPluginsThread");
+  thread->start(QThread::LowestPriority);
+}
+
+void PrefetchPluginsTask::cancel() {
+  if (isCancelled) {
+    *isCancelled = true;
+  }
+}
+
+bool PrefetchPluginsTask::isRunning() const { return thread != nullptr; }
+
+bool PrefetchPluginsTask::wasCancelled() const { return lastRunWasCancelled; }
+
+bool PrefetchPluginsTask::hasResult() const { return result.has_value(); }
+
+std::optional<gui::PrefetchedPlugins> PrefetchPluginsTask::takeResult() {
+  auto taken = std::move(result);
+  result = std::nullopt;
+  return taken;
+}
+
+void PrefetchPluginsTask::onThreadFinished() {
+  thread = nullptr;
+  lastRunWasCancelled = *isCancelled;
+
+  if (!lastRunWasCancelled && threadResult->has_value()) {
+    result = std::move(*threadResult);
+  }
+
+  threadResult.reset();
+  isCancelled.reset();
+
+  emit finished();
+}
+}
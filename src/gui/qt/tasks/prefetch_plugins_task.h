@@ -0,0 +1,79 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_TASKS_PREFETCH_PLUGINS_TASK
+#define LOOT_GUI_QT_TASKS_PREFETCH_PLUGINS_TASK
+
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include "gui/state/game/game.h"
+
+namespace loot {
+// Fully loads a game's plugins in a low-priority background thread so that
+// they're ready by the time they're needed. Unlike the other tasks this isn't
+// run by a TaskExecutor, as it doesn't block the user interface and can be
+// cancelled. Destroying the task cancels any running thread and waits for it
+// to stop, which it does once it has loaded its current batch of plugins.
+class PrefetchPluginsTask : public QObject {
+  Q_OBJECT
+public:
+  explicit PrefetchPluginsTask(QObject* parent);
+  PrefetchPluginsTask(const PrefetchPluginsTask&) = delete;
+  PrefetchPluginsTask(PrefetchPluginsTask&&) = delete;
+  ~PrefetchPluginsTask();
+
+  PrefetchPluginsTask& operator=(const PrefetchPluginsTask&) = delete;
+  PrefetchPluginsTask& operator=(PrefetchPluginsTask&&) = delete;
+
+  void start(const gui::Game& game);
+  // The thread checks for cancellation between batches of plugins, and any
+  // result it produces after being cancelled is discarded.
+  void cancel();
+
+  bool isRunning() const;
+  bool wasCancelled() const;
+  bool hasResult() const;
+  std::optional<gui::PrefetchedPlugins> takeResult();
+
+signals:
+  void finished();
+
+private:
+  QThread* thread{nullptr};
+  std::shared_ptr<std::atomic<bool>> isCancelled;
+  std::shared_ptr<std::optional<gui::PrefetchedPlugins>> threadResult;
+  std::optional<gui::PrefetchedPlugins> result;
+  bool lastRunWasCancelled{false};
+
+private slots:
+  void onThreadFinished();
+};
+}
+
+#endif
@@ -0,0 +1,174 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/tasks/search_plugins_task.h"
+
+#include <QtCore/QRegularExpression>
+#include <optional>
+
+namespace {
+using loot::PluginItem;
+
+// How many plugins to search between checks for a newer search.
+constexpr size_t CANCELLATION_CHECK_INTERVAL = 64;
+
+bool isRegex(const QVariant& text) {
+  return text.userType() == QMetaType::QRegularExpression;
+}
+
+std::optional<std::vector<PluginItem>> findMatchingPlugins(
+    const QVariant& text,
+    const std::vector<PluginItem>& plugins,
+    const std::atomic<uint64_t>& latestGeneration,
+    uint64_t generation) {
+  const auto isRegexText = isRegex(text);
+
+  auto regex = text.toRegularExpression();
+  regex.setPatternOptions(regex.patternOptions() |
+                          QRegularExpression::CaseInsensitiveOption);
+  const auto substring = text.toString();
+
+  std::vector<PluginItem> matches;
+
+  if (isRegexText && !regex.isValid()) {
+    return matches;
+  }
+
+  for (size_t i = 0; i < plugins.size(); i += 1) {
+    if (i % CANCELLATION_CHECK_INTERVAL == 0 &&
+        latestGeneration != generation) {
+      return std::nullopt;
+    }
+
+    const auto& plugin = plugins.at(i);
+    const auto content = QString::fromStdString(plugin.contentToSearch());
+
+    const auto isMatch = isRegexText
+                             ? regex.match(content).hasMatch()
+                             : content.contains(substring, Qt::CaseInsensitive);
+
+    if (isMatch) {
+      matches.push_back(plugin);
+    }
+  }
+
+  return matches;
+}
+}
+
+namespace loot {
+SearchPluginsTask::SearchPluginsTask(QObject* parent) : QObject(parent) {}
+
+SearchPluginsTask::~SearchPluginsTask() {
+  cancel();
+
+  for (const auto thread : threads) {
+    thread->wait();
+    delete thread;
+  }
+}
+
+void SearchPluginsTask::start(const QVariant& text,
+                              std::vector<PluginItem>&& plugins) {
+  // The plugins may have changed since the latest search finished.
+  latestFinishedSearch.reset();
+
+  startSearch(text,
+              std::make_shared<const std::vector<PluginItem>>(
+                  std::move(plugins)));
+}
+
+bool SearchPluginsTask::startNarrowing(const QVariant& text) {
+  // Extending a regex can match more text, so only plain text is narrowed.
+  if (isRegex(text) || !latestFinishedSearch.has_value() ||
+      !text.toString().toCaseFolded().contains(latestFinishedSearch->text)) {
+    return false;
+  }
+
+  startSearch(text, latestFinishedSearch->matches);
+
+  return true;
+}
+
+void SearchPluginsTask::cancel() {
+  ++*latestGeneration;
+  latestFinishedSearch.reset();
+}
+
+void SearchPluginsTask::startSearch(
+    const QVariant& text,
+    std::shared_ptr<const std::vector<PluginItem>> plugins) {
+  const auto generation = ++*latestGeneration;
+
+  // The thread owns shared copies of its state so that a superseded thread
+  // can't interfere with a later one.
+  const auto threadResult =
+      std::make_shared<std::optional<std::vector<PluginItem>>>();
+
+  const auto thread = QThread::create([text,
+                                       plugins,
+                                       latestGeneration = latestGeneration,
+                                       generation,
+                                       threadResult]() {
+    *threadResult =
+        findMatchingPlugins(text, *plugins, *latestGeneration, generation);
+  });
+
+  threads.insert(thread);
+
+  connect(thread,
+          &QThread::finished,
+          this,
+          [this, thread, text, threadResult, generation]() {
+            threads.erase(thread);
+
+            if (*latestGeneration != generation || !threadResult->has_value()) {
+              return;
+            }
+
+            auto matches = std::make_shared<const std::vector<PluginItem>>(
+                std::move(threadResult->value()));
+
+            std::vector<std::string> resultNames;
+            resultNames.reserve(matches->size());
+            for (const auto& plugin : *matches) {
+              resultNames.push_back(plugin.name);
+            }
+
+            if (isRegex(text)) {
+              latestFinishedSearch.reset();
+            } else {
+              latestFinishedSearch = FinishedSearch{
+                  text.toString().toCaseFolded(), std::move(matches)};
+            }
+
+            emit finished(resultNames);
+          });
+  connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+  thread->setObjectName("searchPluginsThread");
+  thread->start();
+}
+}
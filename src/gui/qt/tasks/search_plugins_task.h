@@ -0,0 +1,94 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_TASKS_SEARCH_PLUGINS_TASK
+#define LOOT_GUI_QT_TASKS_SEARCH_PLUGINS_TASK
+
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <QtCore/QVariant>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+// Searches plugins' content in a background thread so that the user interface
+// stays responsive while search text is being typed. Each search is given a
+// generation number, and a search that is superseded stops early and has its
+// results discarded, so only the latest search's results are ever given.
+//
+// The latest finished plain text search's matches are kept so that when the
+// search text is extended, only those matches need to be searched again.
+class SearchPluginsTask : public QObject {
+  Q_OBJECT
+public:
+  explicit SearchPluginsTask(QObject* parent);
+  SearchPluginsTask(const SearchPluginsTask&) = delete;
+  SearchPluginsTask(SearchPluginsTask&&) = delete;
+  ~SearchPluginsTask();
+
+  SearchPluginsTask& operator=(const SearchPluginsTask&) = delete;
+  SearchPluginsTask& operator=(SearchPluginsTask&&) = delete;
+
+  // The text is either a QString or a QRegularExpression, and is matched
+  // case-insensitively.
+  void start(const QVariant& text, std::vector<PluginItem>&& plugins);
+
+  // If the text is plain text that contains the text of the latest finished
+  // search, searches only that search's matches and returns true. Otherwise
+  // returns false without starting a search.
+  bool startNarrowing(const QVariant& text);
+
+  // Also discards the latest finished search's matches, as they may no longer
+  // be up to date by the time another search is started.
+  void cancel();
+
+signals:
+  // Gives the names of the plugins that matched, in the order they were given.
+  void finished(const std::vector<std::string>& resultNames);
+
+private:
+  struct FinishedSearch {
+    // Case-folded so that it can be compared with later search text.
+    QString text;
+    std::shared_ptr<const std::vector<PluginItem>> matches;
+  };
+
+  void startSearch(const QVariant& text,
+                   std::shared_ptr<const std::vector<PluginItem>> plugins);
+
+  std::shared_ptr<std::atomic<uint64_t>> latestGeneration{
+      std::make_shared<std::atomic<uint64_t>>(0)};
+  std::set<QThread*> threads;
+  std::optional<FinishedSearch> latestFinishedSearch;
+};
+}
+
+#endif
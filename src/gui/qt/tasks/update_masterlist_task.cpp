@@ -28,18 +28,14 @@
 #include "gui/qt/helpers.h"
 
 namespace loot {
-UpdatePreludeTask::UpdatePreludeTask(const LootState &state) :
+UpdatePreludeTask::UpdatePreludeTask(const LootState &state,
+                                     NetworkSession &networkSession) :
+    NetworkTask(networkSession),
     preludeSource(state.getSettings().getPreludeSource()),
     preludePath(state.getPreludePath()) {}
 
 void UpdatePreludeTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     if (!isValidUrl(preludeSource)) {
       // Treat the source as a local path, and copy the file from there.
       auto sourcePath = std::filesystem::u8path(preludeSource);
@@ -58,36 +54,24 @@ void UpdatePreludeTask::execute() {
 
     QNetworkRequest request(QUrl(QString::fromStdString(preludeSource)));
 
-    const auto reply = networkAccessManager->get(request);
-
-    connect(reply,
-            &QNetworkReply::finished,
-            this,
-            &UpdatePreludeTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdatePreludeTask::onNetworkError);
-    connect(
-        reply, &QNetworkReply::sslErrors, this, &UpdatePreludeTask::onSSLError);
+    get(request,
+        [this](const NetworkResponse &response) { onResponse(response); });
   } catch (const std::exception &e) {
     handleException(e);
   }
 }
 
-void UpdatePreludeTask::onReplyFinished() {
+void UpdatePreludeTask::onResponse(const NetworkResponse &response) {
   try {
     auto logger = getLogger();
     if (logger) {
       logger->trace("Finished receiving a response for prelude update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto responseData =
+        readResponse(response, "Prelude update response errored");
 
     if (!responseData.has_value()) {
-      emit error("Prelude update response errored");
       return;
     }
 
@@ -100,26 +84,24 @@ void UpdatePreludeTask::onReplyFinished() {
   }
 }
 
-UpdateMasterlistTask::UpdateMasterlistTask(const gui::Game &game) :
+UpdateMasterlistTask::UpdateMasterlistTask(const gui::Game &game,
+                                           NetworkSession &networkSession) :
+    NetworkTask(networkSession),
     masterlistSource(game.GetSettings().MasterlistSource()),
     masterlistPath(game.MasterlistPath()) {}
 
 UpdateMasterlistTask::UpdateMasterlistTask(
     const std::string &gameFolderName,
     const std::string &masterlistSource,
-    const std::filesystem::path &masterlistPath) :
+    const std::filesystem::path &masterlistPath,
+    NetworkSession &networkSession) :
+    NetworkTask(networkSession),
     gameFolderName(gameFolderName),
     masterlistSource(masterlistSource),
     masterlistPath(masterlistPath) {}
 
 void UpdateMasterlistTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     if (!isValidUrl(masterlistSource)) {
       // Treat the source as a local path, and copy the file from there.
       const auto sourcePath = std::filesystem::u8path(masterlistSource);
@@ -138,38 +120,24 @@ void UpdateMasterlistTask::execute() {
 
     QNetworkRequest request(QUrl(QString::fromStdString(masterlistSource)));
 
-    const auto reply = networkAccessManager->get(request);
-
-    connect(reply,
-            &QNetworkReply::finished,
-            this,
-            &UpdateMasterlistTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdateMasterlistTask::onNetworkError);
-    connect(reply,
-            &QNetworkReply::sslErrors,
-            this,
-            &UpdateMasterlistTask::onSSLError);
+    get(request,
+        [this](const NetworkResponse &response) { onResponse(response); });
   } catch (const std::exception &e) {
     handleException(e);
   }
 }
 
-void UpdateMasterlistTask::onReplyFinished() {
+void UpdateMasterlistTask::onResponse(const NetworkResponse &response) {
   try {
     auto logger = getLogger();
     if (logger) {
       logger->trace("Finished receiving a response for masterlist update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto responseData =
+        readResponse(response, "Masterlist update response errored");
 
     if (!responseData.has_value()) {
-      emit error("Masterlist update response errored");
       return;
     }
 
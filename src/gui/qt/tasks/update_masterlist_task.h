@@ -26,15 +26,13 @@
 #ifndef LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 #define LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
-
 #include "gui/qt/tasks/network_task.h"
 
 namespace loot {
 class UpdatePreludeTask : public NetworkTask {
   Q_OBJECT
 public:
-  explicit UpdatePreludeTask(const LootState& state);
+  UpdatePreludeTask(const LootState& state, NetworkSession& networkSession);
 
 public slots:
   void execute() override;
@@ -43,19 +41,17 @@ private:
   std::string preludeSource;
   std::filesystem::path preludePath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
-
-private slots:
-  void onReplyFinished();
+  void onResponse(const NetworkResponse& response);
 };
 
 class UpdateMasterlistTask : public NetworkTask {
   Q_OBJECT
 public:
-  explicit UpdateMasterlistTask(const gui::Game& game);
+  UpdateMasterlistTask(const gui::Game& game, NetworkSession& networkSession);
   UpdateMasterlistTask(const std::string& gameFolderName,
                        const std::string& masterlistSource,
-                       const std::filesystem::path& masterlistPath);
+                       const std::filesystem::path& masterlistPath,
+                       NetworkSession& networkSession);
 
 public slots:
   void execute() override;
@@ -65,10 +61,7 @@ private:
   std::string masterlistSource;
   std::filesystem::path masterlistPath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
-
-private slots:
-  void onReplyFinished();
+  void onResponse(const NetworkResponse& response);
 };
 }
 
@@ -56,7 +56,10 @@ private:
   std::vector<std::pair<PluginItem, bool>> getResult() {
     std::vector<std::pair<PluginItem, bool>> result;
 
-    auto plugin = game_.GetPlugin(pluginName_);
+    // The fully loaded plugins may come from a separate game handle that
+    // was prefetched in the background, so use them only to check for
+    // overlapping records.
+    auto plugin = game_.GetFullyLoadedPlugin(pluginName_);
     if (!plugin) {
       throw std::runtime_error("The plugin \"" + pluginName_ +
                                "\" is not loaded.");
@@ -69,7 +72,11 @@ private:
                      bool isActive) {
           const auto pluginItem = PluginItem(
               *otherPlugin, game_, loadOrderIndex, isActive, language_);
-          const auto conflict = plugin->DoRecordsOverlap(*otherPlugin);
+          const auto fullyLoadedOtherPlugin =
+              game_.GetFullyLoadedPlugin(otherPlugin->GetName());
+          const auto conflict =
+              fullyLoadedOtherPlugin != nullptr &&
+              plugin->DoRecordsOverlap(*fullyLoadedOtherPlugin);
 
           return std::make_pair(pluginItem, conflict);
         };
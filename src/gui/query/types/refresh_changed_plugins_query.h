@@ -0,0 +1,185 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_REFRESH_CHANGED_PLUGINS_QUERY
+#define LOOT_GUI_QUERY_REFRESH_CHANGED_PLUGINS_QUERY
+
+#include <functional>
+#include <map>
+#include <set>
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+#include "gui/state/game/game_files_snapshot.h"
+
+namespace loot {
+// Reloads the game's plugins, load order or BashTags files as required by the
+// given changes, and returns the game's plugin items in load order. If no
+// plugins were added or removed, only the items for plugins that are affected
+// by the changes are rebuilt: the others are copied from the given current
+// items with their active state and load order index updated.
+class RefreshChangedPluginsQuery : public Query {
+public:
+  RefreshChangedPluginsQuery(gui::Game& game,
+                             std::string language,
+                             GameFilesChanges changes,
+                             std::vector<PluginItem> currentItems) :
+      game_(game),
+      language_(language),
+      changes_(std::move(changes)),
+      currentItems_(std::move(currentItems)) {}
+
+  QueryResult executeLogic() override {
+    auto logger = getLogger();
+    if (logger) {
+      logger->info(
+          "Refreshing content after {} plugins and {} BashTags files changed",
+          changes_.plugins.size(),
+          changes_.bashTagsFiles.size());
+    }
+
+    std::map<Filename, bool> previousActiveStates;
+    for (const auto& item : currentItems_) {
+      previousActiveStates.emplace(Filename(item.name), item.isActive);
+    }
+
+    if (!changes_.plugins.empty()) {
+      // The plugins API can't load a subset of plugins without discarding
+      // the rest, but loading headers is cheap compared to rebuilding every
+      // plugin's item, so that's what is kept targeted.
+      game_.LoadAllInstalledPlugins(true);
+    } else {
+      if (changes_.loadOrder) {
+        game_.LoadCurrentLoadOrderState();
+      }
+
+      if (!changes_.bashTagsFiles.empty()) {
+        game_.LoadBashTagsFiles();
+      }
+    }
+
+    const auto pluginsToRebuild = GetPluginsToRebuild(previousActiveStates);
+
+    if (logger) {
+      logger->debug("Rebuilding the data for {} plugins",
+                    pluginsToRebuild.size());
+    }
+
+    std::map<Filename, const PluginItem*> currentItemsByName;
+    for (const auto& item : currentItems_) {
+      currentItemsByName.emplace(Filename(item.name), &item);
+    }
+
+    const std::function<PluginItem(
+        const PluginInterface* const, std::optional<short>, bool)>
+        mapper = [&](const PluginInterface* const plugin,
+                     std::optional<short> loadOrderIndex,
+                     bool isActive) {
+          const auto filename = Filename(plugin->GetName());
+          const auto it = currentItemsByName.find(filename);
+
+          if (it == currentItemsByName.end() ||
+              pluginsToRebuild.count(filename) != 0) {
+            return PluginItem(
+                *plugin, game_, loadOrderIndex, isActive, language_);
+          }
+
+          auto item = *it->second;
+          item.loadOrderIndex = loadOrderIndex;
+          item.isActive = isActive;
+          return item;
+        };
+
+    return MapFromLoadOrderData(game_, game_.GetLoadOrder(), mapper);
+  }
+
+private:
+  std::set<Filename> GetPluginsToRebuild(
+      const std::map<Filename, bool>& previousActiveStates) const {
+    // Any plugin's requirement, incompatibility and condition messages may
+    // name a plugin that was added or removed, so rebuild every plugin if
+    // the set of installed plugins has changed.
+    const auto plugins = game_.GetPlugins();
+    bool isPluginSetChanged = plugins.size() != previousActiveStates.size();
+    for (size_t i = 0; i < plugins.size() && !isPluginSetChanged; i += 1) {
+      isPluginSetChanged =
+          previousActiveStates.count(Filename(plugins[i]->GetName())) == 0;
+    }
+
+    if (isPluginSetChanged) {
+      std::set<Filename> allPlugins;
+      for (const auto& plugin : plugins) {
+        allPlugins.insert(Filename(plugin->GetName()));
+      }
+      return allPlugins;
+    }
+
+    // Plugins that changed on disk or that changed active state affect
+    // their own messages and the messages of plugins that have them as
+    // masters.
+    std::set<Filename> changedPlugins = changes_.plugins;
+    for (const auto& plugin : game_.GetPlugins()) {
+      const auto filename = Filename(plugin->GetName());
+      const auto it = previousActiveStates.find(filename);
+      if (it != previousActiveStates.end() &&
+          it->second != game_.IsPluginActive(plugin->GetName())) {
+        changedPlugins.insert(filename);
+      }
+    }
+
+    std::set<Filename> pluginsToRebuild = changedPlugins;
+    for (const auto& plugin : game_.GetPlugins()) {
+      const auto filename = Filename(plugin->GetName());
+      if (pluginsToRebuild.count(filename) != 0) {
+        continue;
+      }
+
+      if (changes_.bashTagsFiles.count(
+              Filename(std::filesystem::u8path(plugin->GetName())
+                           .stem()
+                           .u8string())) != 0) {
+        pluginsToRebuild.insert(filename);
+        continue;
+      }
+
+      for (const auto& master : plugin->GetMasters()) {
+        if (changedPlugins.count(Filename(master)) != 0) {
+          pluginsToRebuild.insert(filename);
+          break;
+        }
+      }
+    }
+
+    return pluginsToRebuild;
+  }
+
+  gui::Game& game_;
+  std::string language_;
+  GameFilesChanges changes_;
+  std::vector<PluginItem> currentItems_;
+};
+}
+
+#endif
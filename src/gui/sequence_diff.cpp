@@ -0,0 +1,124 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/sequence_diff.h"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+// Returns flags that are true for the values that make up a longest strictly
+// increasing subsequence of the given values.
+std::vector<bool> FindLongestIncreasingSubsequence(
+    const std::vector<size_t>& values) {
+  // tailIndices[i] is the index of the smallest value that ends an increasing
+  // subsequence of length i + 1.
+  std::vector<size_t> tailIndices;
+  std::vector<std::optional<size_t>> predecessorIndices(values.size());
+
+  for (size_t i = 0; i < values.size(); i += 1) {
+    const auto it = std::lower_bound(
+        tailIndices.begin(),
+        tailIndices.end(),
+        values.at(i),
+        [&](size_t tailIndex, size_t value) {
+          return values.at(tailIndex) < value;
+        });
+
+    if (it != tailIndices.begin()) {
+      predecessorIndices.at(i) = *std::prev(it);
+    }
+
+    if (it == tailIndices.end()) {
+      tailIndices.push_back(i);
+    } else {
+      *it = i;
+    }
+  }
+
+  std::vector<bool> isInSubsequence(values.size(), false);
+  if (tailIndices.empty()) {
+    return isInSubsequence;
+  }
+
+  std::optional<size_t> index = tailIndices.back();
+  while (index.has_value()) {
+    isInSubsequence.at(index.value()) = true;
+    index = predecessorIndices.at(index.value());
+  }
+
+  return isInSubsequence;
+}
+}
+
+namespace loot {
+std::optional<SequenceDiff> DiffSequences(
+    const std::vector<std::string>& oldSequence,
+    const std::vector<std::string>& newSequence) {
+  std::unordered_map<std::string_view, size_t> newIndices;
+  for (size_t i = 0; i < newSequence.size(); i += 1) {
+    if (!newIndices.emplace(newSequence.at(i), i).second) {
+      return std::nullopt;
+    }
+  }
+
+  SequenceDiff diff;
+
+  // The new indices of elements that are in both sequences, in their old
+  // order.
+  std::vector<size_t> commonNewIndices;
+  std::vector<bool> isInOldSequence(newSequence.size(), false);
+  for (size_t i = 0; i < oldSequence.size(); i += 1) {
+    const auto it = newIndices.find(oldSequence.at(i));
+    if (it == newIndices.end()) {
+      diff.removed.push_back(i);
+    } else if (isInOldSequence.at(it->second)) {
+      return std::nullopt;
+    } else {
+      isInOldSequence.at(it->second) = true;
+      commonNewIndices.push_back(it->second);
+    }
+  }
+
+  // The elements that are already in the same relative order don't need to
+  // move, so keep as many of them as possible where they are.
+  const auto isUnmoved = FindLongestIncreasingSubsequence(commonNewIndices);
+  for (size_t i = 0; i < commonNewIndices.size(); i += 1) {
+    if (!isUnmoved.at(i)) {
+      diff.moved.push_back(commonNewIndices.at(i));
+    }
+  }
+  std::sort(diff.moved.begin(), diff.moved.end());
+
+  for (size_t i = 0; i < newSequence.size(); i += 1) {
+    if (!isInOldSequence.at(i)) {
+      diff.inserted.push_back(i);
+    }
+  }
+
+  return diff;
+}
+}
@@ -0,0 +1,54 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_SEQUENCE_DIFF
+#define LOOT_GUI_SEQUENCE_DIFF
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace loot {
+// Describes how to turn one sequence into another by removing, moving and
+// inserting elements, moving as few elements as possible.
+struct SequenceDiff {
+  // Indices in the old sequence of elements that aren't in the new sequence,
+  // in ascending order.
+  std::vector<size_t> removed;
+  // Indices in the new sequence of elements that are in both sequences but
+  // aren't in the same relative order, in ascending order.
+  std::vector<size_t> moved;
+  // Indices in the new sequence of elements that aren't in the old sequence,
+  // in ascending order.
+  std::vector<size_t> inserted;
+};
+
+// Returns nullopt if either sequence contains duplicate elements.
+std::optional<SequenceDiff> DiffSequences(
+    const std::vector<std::string>& oldSequence,
+    const std::vector<std::string>& newSequence);
+}
+
+#endif
@@ -27,8 +27,7 @@
 
 #include <spdlog/fmt/fmt.h>
 
-#include <boost/locale.hpp>
-
+#include "gui/message_templates.h"
 #include "gui/state/game/helpers.h"
 
 namespace loot {
@@ -65,7 +64,7 @@ std::string MessagesAsMarkdown(const std::vector<SourcedMessage>& messages) {
       content += "Note: ";
     }
 
-    content += message.text + "\n";
+    content += message.text.str() + "\n";
   }
 
   return content;
@@ -73,73 +72,64 @@ std::string MessagesAsMarkdown(const std::vector<SourcedMessage>& messages) {
 
 SourcedMessage ToSourcedMessage(const PluginCleaningData& cleaningData,
                                 const std::string& language) {
-  using boost::locale::translate;
   using fmt::format;
 
-  const std::string itmRecords =
-      format(translate("{0} ITM record",
-                       "{0} ITM records",
-                       static_cast<int>(cleaningData.GetITMCount()))
-                 .str(),
-             cleaningData.GetITMCount());
-  const std::string deletedReferences = format(
-      translate("{0} deleted reference",
-                "{0} deleted references",
-                static_cast<int>(cleaningData.GetDeletedReferenceCount()))
-          .str(),
-      cleaningData.GetDeletedReferenceCount());
+  const auto itmCount = cleaningData.GetITMCount();
+  const auto deletedReferenceCount = cleaningData.GetDeletedReferenceCount();
+  const auto deletedNavmeshCount = cleaningData.GetDeletedNavmeshCount();
+
+  const std::string itmRecords = format(
+      GetMessageTemplate(PluralMessageTemplateId::itmRecords, itmCount),
+      itmCount);
+  const std::string deletedReferences =
+      format(GetMessageTemplate(PluralMessageTemplateId::deletedReferences,
+                                deletedReferenceCount),
+             deletedReferenceCount);
   const std::string deletedNavmeshes =
-      format(translate("{0} deleted navmesh",
-                       "{0} deleted navmeshes",
-                       static_cast<int>(cleaningData.GetDeletedNavmeshCount()))
-                 .str(),
-             cleaningData.GetDeletedNavmeshCount());
+      format(GetMessageTemplate(PluralMessageTemplateId::deletedNavmeshes,
+                                deletedNavmeshCount),
+             deletedNavmeshCount);
 
   std::string message;
-  if (cleaningData.GetITMCount() > 0 &&
-      cleaningData.GetDeletedReferenceCount() > 0 &&
-      cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1}, {2} and {3}.").str(),
+  if (itmCount > 0 && deletedReferenceCount > 0 && deletedNavmeshCount > 0) {
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundThree),
                      cleaningData.GetCleaningUtility(),
                      itmRecords,
                      deletedReferences,
                      deletedNavmeshes);
-  } else if (cleaningData.GetITMCount() == 0 &&
-             cleaningData.GetDeletedReferenceCount() == 0 &&
-             cleaningData.GetDeletedNavmeshCount() == 0) {
-    message = format(translate("{0} found dirty edits.").str(),
-                     cleaningData.GetCleaningUtility());
-  } else if (cleaningData.GetITMCount() == 0 &&
-             cleaningData.GetDeletedReferenceCount() > 0 &&
-             cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
+  } else if (itmCount == 0 && deletedReferenceCount == 0 &&
+             deletedNavmeshCount == 0) {
+    message =
+        format(GetMessageTemplate(MessageTemplateId::cleaningFoundDirtyEdits),
+               cleaningData.GetCleaningUtility());
+  } else if (itmCount == 0 && deletedReferenceCount > 0 &&
+             deletedNavmeshCount > 0) {
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundTwo),
                      cleaningData.GetCleaningUtility(),
                      deletedReferences,
                      deletedNavmeshes);
-  } else if (cleaningData.GetITMCount() > 0 &&
-             cleaningData.GetDeletedReferenceCount() == 0 &&
-             cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
+  } else if (itmCount > 0 && deletedReferenceCount == 0 &&
+             deletedNavmeshCount > 0) {
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundTwo),
                      cleaningData.GetCleaningUtility(),
                      itmRecords,
                      deletedNavmeshes);
-  } else if (cleaningData.GetITMCount() > 0 &&
-             cleaningData.GetDeletedReferenceCount() > 0 &&
-             cleaningData.GetDeletedNavmeshCount() == 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
+  } else if (itmCount > 0 && deletedReferenceCount > 0 &&
+             deletedNavmeshCount == 0) {
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundTwo),
                      cleaningData.GetCleaningUtility(),
                      itmRecords,
                      deletedReferences);
-  } else if (cleaningData.GetITMCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
+  } else if (itmCount > 0)
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundOne),
                      cleaningData.GetCleaningUtility(),
                      itmRecords);
-  else if (cleaningData.GetDeletedReferenceCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
+  else if (deletedReferenceCount > 0)
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundOne),
                      cleaningData.GetCleaningUtility(),
                      deletedReferences);
-  else if (cleaningData.GetDeletedNavmeshCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
+  else if (deletedNavmeshCount > 0)
+    message = format(GetMessageTemplate(MessageTemplateId::cleaningFoundOne),
                      cleaningData.GetCleaningUtility(),
                      deletedNavmeshes);
 
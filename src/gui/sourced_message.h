@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "gui/interned_string.h"
 #include "loot/metadata/message.h"
 #include "loot/metadata/plugin_cleaning_data.h"
 
@@ -56,7 +57,8 @@ enum struct MessageSource : unsigned int {
 struct SourcedMessage {
   MessageType type{MessageType::say};
   MessageSource source{MessageSource::messageMetadata};
-  std::string text;
+  // Interned so that copies of messages share their text.
+  InternedString text;
 };
 
 bool operator==(const SourcedMessage& lhs, const SourcedMessage& rhs);
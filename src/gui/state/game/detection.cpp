@@ -57,6 +57,12 @@ void UpdateInstalledGamesSettings(
   const auto gameInstalls = FindGameInstalls(
       registry, heroicConfigPaths, xboxGamingRootPaths, preferredUILanguages);
 
+  UpdateInstalledGamesSettings(gamesSettings, gameInstalls);
+}
+
+void UpdateInstalledGamesSettings(
+    std::vector<GameSettings>& gamesSettings,
+    const std::vector<GameInstall>& gameInstalls) {
   const auto newGameInstalls =
       UpdateMatchingSettings(gamesSettings, gameInstalls, ArePathsEquivalent);
 
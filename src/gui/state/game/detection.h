@@ -51,6 +51,9 @@ void UpdateInstalledGamesSettings(
     const std::vector<std::filesystem::path>& heroicConfigPaths,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages);
+
+void UpdateInstalledGamesSettings(std::vector<GameSettings>& gamesSettings,
+                                  const std::vector<GameInstall>& gameInstalls);
 }
 
 #endif
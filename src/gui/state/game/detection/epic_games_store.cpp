@@ -31,6 +31,9 @@
 #include <QtCore/QJsonValue>
 #include <QtCore/QString>
 #include <boost/algorithm/string.hpp>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "gui/state/game/detection/common.h"
 
@@ -59,6 +62,14 @@ struct EgsManifestData {
   std::string installLocation;
 };
 
+// Maps the AppName of each manifest in a manifests directory to its
+// InstallLocation.
+struct EgsManifestIndex {
+  std::filesystem::path manifestsPath;
+  std::filesystem::file_time_type lastWriteTime;
+  std::unordered_map<std::string, std::string> installLocations;
+};
+
 std::optional<std::string> GetEgsAppName(GameId gameId) {
   switch (gameId) {
     case GameId::tes5se:
@@ -201,11 +212,60 @@ EgsManifestData GetEgsManifestData(const std::filesystem::path& manifestPath) {
   return data;
 }
 
+EgsManifestIndex BuildEgsManifestIndex(
+    const std::filesystem::path& manifestsPath,
+    std::filesystem::file_time_type lastWriteTime) {
+  EgsManifestIndex index{manifestsPath, lastWriteTime, {}};
+
+  // Unfortunately we don't know which manifest file belongs to which game, so
+  // they all need to be read.
+  for (const auto& entry : std::filesystem::directory_iterator(manifestsPath)) {
+    if (entry.is_regular_file() &&
+        boost::iends_with(entry.path().filename().u8string(), ".item")) {
+      auto manifestData = GetEgsManifestData(entry.path());
+
+      if (!manifestData.appName.empty()) {
+        index.installLocations.emplace(
+            std::move(manifestData.appName),
+            std::move(manifestData.installLocation));
+      }
+    }
+  }
+
+  return index;
+}
+
+std::shared_ptr<const EgsManifestIndex> GetEgsManifestIndex(
+    const std::filesystem::path& manifestsPath) {
+  // Detection checks each game in turn, so keep the index between checks
+  // instead of reading every manifest for each game. Adding or removing a
+  // manifest changes the directory's last write time, which invalidates the
+  // index.
+  static std::mutex mutex;
+  static std::shared_ptr<const EgsManifestIndex> cachedIndex;
+
+  const auto lastWriteTime = std::filesystem::last_write_time(manifestsPath);
+
+  std::lock_guard<std::mutex> guard(mutex);
+
+  if (cachedIndex == nullptr || cachedIndex->manifestsPath != manifestsPath ||
+      cachedIndex->lastWriteTime != lastWriteTime) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->trace("Indexing EGS manifest files in {}.",
+                    manifestsPath.u8string());
+    }
+
+    cachedIndex = std::make_shared<const EgsManifestIndex>(
+        BuildEgsManifestIndex(manifestsPath, lastWriteTime));
+  }
+
+  return cachedIndex;
+}
+
 std::optional<std::filesystem::path> GetEgsGameInstallPath(
     const loot::RegistryInterface& registry,
     const loot::GameId gameId) {
-  // Unfortunately we don't know which is the right manifest file, so iterate
-  // over them until the one containing the correct AppName is found.
   const auto expectedAppName = GetEgsAppName(gameId);
 
   if (!expectedAppName.has_value()) {
@@ -228,26 +288,20 @@ std::optional<std::filesystem::path> GetEgsGameInstallPath(
         loot::GetGameName(gameId));
   }
 
-  for (const auto& entry :
-       std::filesystem::directory_iterator(egsManifestsPath.value())) {
-    if (entry.is_regular_file() &&
-        boost::iends_with(entry.path().filename().u8string(), ".item")) {
-      const auto manifestData = GetEgsManifestData(entry.path());
+  const auto index = GetEgsManifestIndex(egsManifestsPath.value());
+  const auto it = index->installLocations.find(expectedAppName.value());
 
-      if (manifestData.appName == expectedAppName) {
-        if (logger) {
-          logger->trace(
-              "Extracted install location {} from manifest file at {}.",
-              manifestData.installLocation,
-              entry.path().u8string());
-        }
+  if (it == index->installLocations.end()) {
+    return std::nullopt;
+  }
 
-        return std::filesystem::u8path(manifestData.installLocation);
-      }
-    }
+  if (logger) {
+    logger->trace("Found install location {} for EGS AppName {}.",
+                  it->second,
+                  it->first);
   }
 
-  return std::nullopt;
+  return std::filesystem::u8path(it->second);
 }
 
 std::filesystem::path GetAppDataPath(const GameId gameId) {
@@ -271,6 +325,11 @@ std::optional<std::string> GetEgsAppName(const GameId gameId) {
   return ::GetEgsAppName(gameId);
 }
 
+std::optional<std::filesystem::path> GetEgsManifestsPath(
+    const RegistryInterface& registry) {
+  return ::GetEgsManifestsPath(registry);
+}
+
 std::string GetAppDataFolderName(const GameId gameId) {
   switch (gameId) {
     case GameId::tes5se:
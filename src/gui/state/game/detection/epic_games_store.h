@@ -38,6 +38,11 @@ std::optional<std::string> GetEgsAppName(const GameId gameId);
 
 std::string GetAppDataFolderName(const GameId gameId);
 
+// Returns nullopt if the path of the Epic Games Launcher's manifests directory
+// can't be found.
+std::optional<std::filesystem::path> GetEgsManifestsPath(
+    const RegistryInterface& registry);
+
 std::optional<std::filesystem::path> FindGameInstallPath(
     const GameId gameId,
     const std::filesystem::path& rootInstallPath,
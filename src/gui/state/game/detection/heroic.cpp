@@ -31,7 +31,10 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtCore/QString>
+#include <algorithm>
 #include <functional>
+#include <future>
+#include <mutex>
 
 #include "gui/helpers.h"
 #include "gui/state/game/detection/common.h"
@@ -64,6 +67,7 @@ using loot::GameInstall;
 using loot::getLogger;
 using loot::InstallSource;
 using loot::heroic::HeroicGame;
+using loot::heroic::HeroicSnapshot;
 
 std::map<std::string, GameId> GetGogGameIdMap() {
   std::map<std::string, GameId> map;
@@ -159,9 +163,89 @@ std::optional<HeroicGame> GetGameMetdata(
   return game;
 }
 
-std::optional<GameInstall> FindGogGameInstall(
+std::filesystem::path GetInstalledGogGamesPath(
+    const std::filesystem::path& heroicConfigPath) {
+  return heroicConfigPath / "gog_store" / "installed.json";
+}
+
+std::filesystem::path GetInstalledEgsGamesPath(
+    const std::filesystem::path& heroicConfigPath) {
+  return heroicConfigPath / "legendaryConfig" / "legendary" /
+         "installed.json";
+}
+
+std::filesystem::path GetGameConfigPath(
     const std::filesystem::path& heroicConfigPath,
-    const HeroicGame& game) {
+    const std::string& appName) {
+  return heroicConfigPath / "GamesConfig" / (appName + ".json");
+}
+
+std::vector<HeroicGame> GetInstalledGogGames(const QJsonObject& json) {
+  std::vector<HeroicGame> games;
+
+  const auto installedGames = json.value("installed").toArray();
+  for (const auto& installedGame : installedGames) {
+    const auto game = GetGameMetdata(installedGame, "appName", GOG_GAME_ID_MAP);
+    if (game.has_value()) {
+      games.push_back(game.value());
+    }
+  }
+
+  return games;
+}
+
+std::vector<HeroicGame> GetInstalledEgsGames(const QJsonObject& json) {
+  std::vector<HeroicGame> games;
+
+  for (const auto& installedGame : json) {
+    const auto game =
+        GetGameMetdata(installedGame, "app_name", EGS_GAME_ID_MAP);
+    if (game.has_value()) {
+      games.push_back(game.value());
+    }
+  }
+
+  return games;
+}
+
+std::optional<std::filesystem::path> GetWinePrefix(
+    const QJsonObject& json,
+    const std::string& appName,
+    const std::filesystem::path& gameConfigPath) {
+  const auto logger = getLogger();
+
+  const auto config = json.value(QString::fromStdString(appName));
+
+  if (config == QJsonValue::Undefined) {
+    if (logger) {
+      logger->error("Could not find app name {} in file {}",
+                    appName,
+                    gameConfigPath.u8string());
+    }
+    return std::nullopt;
+  }
+
+  const auto winePrefix = config.toObject().value("winePrefix");
+  if (winePrefix == QJsonValue::Undefined) {
+    if (logger) {
+      logger->error("Could not find winePrefix for app name {} in file {}",
+                    appName,
+                    gameConfigPath.u8string());
+    }
+    return std::nullopt;
+  }
+
+  return std::filesystem::u8path(winePrefix.toString().toStdString());
+}
+
+std::filesystem::path GetGameLocalPath(const std::filesystem::path& winePrefix,
+                                       const std::string& gameFolderName) {
+  return winePrefix / "pfx" / "drive_c" / "users" / "steamuser" / "AppData" /
+         "Local" / std::filesystem::u8path(gameFolderName);
+}
+
+std::optional<GameInstall> FindGogGameInstall(const HeroicSnapshot& snapshot,
+                                              const HeroicGame& game) {
   if (!IsValidGamePath(
           game.gameId, GetMasterFilename(game.gameId), game.installPath)) {
     return std::nullopt;
@@ -172,8 +256,7 @@ std::optional<GameInstall> FindGogGameInstall(
   // The game's config file does not hold the game's local path on Windows.
   const auto folderName = loot::gog::GetAppDataFolderName(game.gameId);
   if (folderName.has_value()) {
-    localPath = loot::heroic::GetGameLocalPath(
-        heroicConfigPath, game.appName, folderName.value());
+    localPath = snapshot.GetGameLocalPath(game.appName, folderName.value());
   }
 #endif
 
@@ -182,7 +265,7 @@ std::optional<GameInstall> FindGogGameInstall(
 }
 
 std::optional<GameInstall> FindEgsGameInstall(
-    const std::filesystem::path& heroicConfigPath,
+    const HeroicSnapshot& snapshot,
     const std::vector<std::string>& preferredUILanguages,
     const HeroicGame& game) {
   const auto localisedInstallPath = loot::epic::FindGameInstallPath(
@@ -196,8 +279,7 @@ std::optional<GameInstall> FindEgsGameInstall(
   std::filesystem::path localPath;
 #else
   const auto folderName = loot::epic::GetAppDataFolderName(game.gameId);
-  const auto localPath = loot::heroic::GetGameLocalPath(
-      heroicConfigPath, game.appName, folderName);
+  const auto localPath = snapshot.GetGameLocalPath(game.appName, folderName);
 #endif
 
   return GameInstall{game.gameId,
@@ -208,112 +290,150 @@ std::optional<GameInstall> FindEgsGameInstall(
 }
 
 namespace loot::heroic {
-std::vector<std::filesystem::path> GetHeroicGamesLauncherConfigPaths() {
-#ifdef _WIN32
-  return {GetUserConfigPath() / "heroic"};
-#else
-  return {GetUserConfigPath() / "heroic",
-          loot::getUserProfilePath() / ".var" / "app" /
-              "com.heroicgameslauncher.hgl" / "config" / "heroic"};
-#endif
-}
-
-std::vector<HeroicGame> GetInstalledGogGames(
-    const std::filesystem::path& heroicConfigPath) {
+HeroicSnapshot::HeroicSnapshot(const std::filesystem::path& heroicConfigPath) {
   const auto logger = getLogger();
 
-  const auto installedGamesPath =
-      heroicConfigPath / "gog_store" / "installed.json";
+  const auto gogInstalledGamesPath = GetInstalledGogGamesPath(heroicConfigPath);
+  const auto egsInstalledGamesPath = GetInstalledEgsGamesPath(heroicConfigPath);
 
   if (logger) {
-    logger->trace("Reading Heroic installed GOG games file at {}.",
-                  installedGamesPath.u8string());
+    logger->trace("Reading Heroic installed games files at {} and {}.",
+                  gogInstalledGamesPath.u8string(),
+                  egsInstalledGamesPath.u8string());
   }
 
-  const auto json = ReadJsonObjectFromFile(installedGamesPath);
+  fileStates_.emplace_back(gogInstalledGamesPath,
+                           GetFileState(gogInstalledGamesPath));
+  fileStates_.emplace_back(egsInstalledGamesPath,
+                           GetFileState(egsInstalledGamesPath));
 
-  std::vector<HeroicGame> games;
+  // The files are independent, so read them in parallel.
+  auto gogGames = std::async(std::launch::async, [&]() {
+    return ::GetInstalledGogGames(
+        ReadJsonObjectFromFile(gogInstalledGamesPath));
+  });
+  egsGames_ =
+      ::GetInstalledEgsGames(ReadJsonObjectFromFile(egsInstalledGamesPath));
+  gogGames_ = gogGames.get();
 
-  const auto installedGames = json.value("installed").toArray();
-  for (const auto& installedGame : installedGames) {
-    const auto game = GetGameMetdata(installedGame, "appName", GOG_GAME_ID_MAP);
-    if (game.has_value()) {
-      games.push_back(game.value());
+#ifndef _WIN32
+  // Game config files are only needed to get local paths, and they don't hold
+  // them on Windows.
+  std::vector<std::string> appNames;
+  for (const auto& game : gogGames_) {
+    appNames.push_back(game.appName);
+  }
+  for (const auto& game : egsGames_) {
+    appNames.push_back(game.appName);
+  }
+
+  std::vector<std::future<std::optional<std::filesystem::path>>> winePrefixes;
+  for (const auto& appName : appNames) {
+    const auto gameConfigPath = GetGameConfigPath(heroicConfigPath, appName);
+
+    if (logger) {
+      logger->trace("Reading Heroic game config file at {}.",
+                    gameConfigPath.u8string());
     }
+
+    fileStates_.emplace_back(gameConfigPath, GetFileState(gameConfigPath));
+
+    winePrefixes.push_back(
+        std::async(std::launch::async, [appName, gameConfigPath]() {
+          return GetWinePrefix(
+              ReadJsonObjectFromFile(gameConfigPath), appName, gameConfigPath);
+        }));
   }
 
-  return games;
+  for (size_t i = 0; i < appNames.size(); i += 1) {
+    winePrefixes_.emplace(appNames.at(i), winePrefixes.at(i).get());
+  }
+#endif
 }
 
-std::vector<HeroicGame> GetInstalledEgsGames(
+std::shared_ptr<const HeroicSnapshot> HeroicSnapshot::Get(
     const std::filesystem::path& heroicConfigPath) {
-  const auto logger = getLogger();
+  static std::mutex mutex;
+  static std::map<std::filesystem::path, std::shared_ptr<const HeroicSnapshot>>
+      snapshots;
 
-  const auto installedGamesPath =
-      heroicConfigPath / "legendaryConfig" / "legendary" / "installed.json";
+  std::lock_guard<std::mutex> guard(mutex);
 
-  if (logger) {
-    logger->trace("Reading Heroic installed EGS games file at {}.",
-                  installedGamesPath.u8string());
+  const auto it = snapshots.find(heroicConfigPath);
+  if (it != snapshots.end() && it->second->IsUpToDate()) {
+    return it->second;
   }
 
-  const auto json = ReadJsonObjectFromFile(installedGamesPath);
+  auto snapshot = std::make_shared<const HeroicSnapshot>(heroicConfigPath);
+  snapshots.insert_or_assign(heroicConfigPath, snapshot);
 
-  std::vector<HeroicGame> games;
+  return snapshot;
+}
 
-  for (const auto& installedGame : json) {
-    const auto game =
-        GetGameMetdata(installedGame, "app_name", EGS_GAME_ID_MAP);
-    if (game.has_value()) {
-      games.push_back(game.value());
-    }
+bool HeroicSnapshot::IsUpToDate() const {
+  return std::all_of(
+      fileStates_.begin(), fileStates_.end(), [](const auto& fileState) {
+        const auto currentState = GetFileState(fileState.first);
+        const auto& state = fileState.second;
+
+        return currentState.exists == state.exists &&
+               currentState.size == state.size &&
+               currentState.lastWriteTime == state.lastWriteTime;
+      });
+}
+
+std::vector<std::filesystem::path> HeroicSnapshot::GetSourcePaths() const {
+  std::vector<std::filesystem::path> paths;
+  paths.reserve(fileStates_.size());
+  for (const auto& fileState : fileStates_) {
+    paths.push_back(fileState.first);
   }
 
-  return games;
+  return paths;
 }
 
-std::filesystem::path GetGameLocalPath(
-    const std::filesystem::path& heroicConfigPath,
-    const std::string& appName,
-    const std::string& gameFolderName) {
-  const auto logger = getLogger();
+const std::vector<HeroicGame>& HeroicSnapshot::GetInstalledGogGames() const {
+  return gogGames_;
+}
 
-  const auto gameConfigPath =
-      heroicConfigPath / "GamesConfig" / (appName + ".json");
+const std::vector<HeroicGame>& HeroicSnapshot::GetInstalledEgsGames() const {
+  return egsGames_;
+}
 
-  if (logger) {
-    logger->trace("Reading Heroic game config file at {}.",
-                  gameConfigPath.u8string());
+std::filesystem::path HeroicSnapshot::GetGameLocalPath(
+    const std::string& appName,
+    const std::string& gameFolderName) const {
+  const auto it = winePrefixes_.find(appName);
+  if (it == winePrefixes_.end() || !it->second.has_value()) {
+    throw std::runtime_error(
+        "Could not find winePrefix in Heroic game config file");
   }
 
-  const auto json = ReadJsonObjectFromFile(gameConfigPath);
+  return ::GetGameLocalPath(it->second.value(), gameFolderName);
+}
 
-  const auto config = json.value(QString::fromStdString(appName));
+HeroicSnapshot::FileState HeroicSnapshot::GetFileState(
+    const std::filesystem::path& path) {
+  std::error_code errorCode;
 
-  if (config == QJsonValue::Undefined) {
-    if (logger) {
-      logger->error("Could not find app name {} in file {}",
-                    appName,
-                    gameConfigPath.u8string());
-    }
-    throw std::runtime_error(
-        "Could not find expected app name in Heroic game config file");
+  FileState state;
+  state.exists = std::filesystem::is_regular_file(path, errorCode);
+  if (state.exists) {
+    state.size = std::filesystem::file_size(path, errorCode);
+    state.lastWriteTime = std::filesystem::last_write_time(path, errorCode);
   }
 
-  const auto winePrefix = config.toObject().value("winePrefix");
-  if (winePrefix == QJsonValue::Undefined) {
-    if (logger) {
-      logger->error("Could not find winePrefix for app name {} in file {}",
-                    appName,
-                    gameConfigPath.u8string());
-    }
-    throw std::runtime_error(
-        "Could not find winePrefix in Heroic game config file");
-  }
+  return state;
+}
 
-  return std::filesystem::u8path(winePrefix.toString().toStdString()) / "pfx" /
-         "drive_c" / "users" / "steamuser" / "AppData" / "Local" /
-         std::filesystem::u8path(gameFolderName);
+std::vector<std::filesystem::path> GetHeroicGamesLauncherConfigPaths() {
+#ifdef _WIN32
+  return {GetUserConfigPath() / "heroic"};
+#else
+  return {GetUserConfigPath() / "heroic",
+          loot::getUserProfilePath() / ".var" / "app" /
+              "com.heroicgameslauncher.hgl" / "config" / "heroic"};
+#endif
 }
 
 std::vector<GameInstall> FindGameInstalls(
@@ -323,10 +443,24 @@ std::vector<GameInstall> FindGameInstalls(
 
   std::vector<GameInstall> installs;
 
+  std::shared_ptr<const HeroicSnapshot> snapshot;
+  try {
+    snapshot = HeroicSnapshot::Get(heroicConfigPath);
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error(
+          "Failed to read Heroic Games Launcher config, using config path {}: "
+          "{}",
+          heroicConfigPath.u8string(),
+          e.what());
+    }
+    return installs;
+  }
+
   try {
-    for (const auto& game : GetInstalledGogGames(heroicConfigPath)) {
+    for (const auto& game : snapshot->GetInstalledGogGames()) {
       try {
-        const auto install = FindGogGameInstall(heroicConfigPath, game);
+        const auto install = FindGogGameInstall(*snapshot, game);
         if (install.has_value()) {
           installs.push_back(install.value());
         }
@@ -352,10 +486,10 @@ std::vector<GameInstall> FindGameInstalls(
   }
 
   try {
-    for (const auto& game : GetInstalledEgsGames(heroicConfigPath)) {
+    for (const auto& game : snapshot->GetInstalledEgsGames()) {
       try {
         const auto install =
-            FindEgsGameInstall(heroicConfigPath, preferredUILanguages, game);
+            FindEgsGameInstall(*snapshot, preferredUILanguages, game);
         if (install.has_value()) {
           installs.push_back(install.value());
         }
@@ -26,7 +26,11 @@
 #ifndef LOOT_GUI_STATE_GAME_DETECTION_HEROIC
 #define LOOT_GUI_STATE_GAME_DETECTION_HEROIC
 
+#include <cstdint>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,18 +43,47 @@ struct HeroicGame {
   std::filesystem::path installPath;
 };
 
-std::vector<std::filesystem::path> GetHeroicGamesLauncherConfigPaths();
+// The content of the Heroic Games Launcher config files that are used to find
+// game installs, so that each file only needs to be read and parsed once.
+class HeroicSnapshot {
+public:
+  explicit HeroicSnapshot(const std::filesystem::path& heroicConfigPath);
 
-std::vector<HeroicGame> GetInstalledGogGames(
-    const std::filesystem::path& heroicConfigPath);
+  // Returns a snapshot of the given config path, reusing a previous snapshot
+  // if none of the files that it read have changed since.
+  static std::shared_ptr<const HeroicSnapshot> Get(
+      const std::filesystem::path& heroicConfigPath);
 
-std::vector<HeroicGame> GetInstalledEgsGames(
-    const std::filesystem::path& heroicConfigPath);
+  bool IsUpToDate() const;
 
-std::filesystem::path GetGameLocalPath(
-    const std::filesystem::path& heroicConfigPath,
-    const std::string& appName,
-    const std::string& gameFolderName);
+  // The paths of the files that the snapshot read, including those that
+  // didn't exist.
+  std::vector<std::filesystem::path> GetSourcePaths() const;
+
+  const std::vector<HeroicGame>& GetInstalledGogGames() const;
+  const std::vector<HeroicGame>& GetInstalledEgsGames() const;
+
+  std::filesystem::path GetGameLocalPath(
+      const std::string& appName,
+      const std::string& gameFolderName) const;
+
+private:
+  struct FileState {
+    bool exists{false};
+    std::uintmax_t size{0};
+    std::filesystem::file_time_type lastWriteTime;
+  };
+
+  static FileState GetFileState(const std::filesystem::path& path);
+
+  std::vector<std::pair<std::filesystem::path, FileState>> fileStates_;
+  std::vector<HeroicGame> gogGames_;
+  std::vector<HeroicGame> egsGames_;
+  // Keyed by app name, nullopt if the game's config has no Wine prefix.
+  std::map<std::string, std::optional<std::filesystem::path>> winePrefixes_;
+};
+
+std::vector<std::filesystem::path> GetHeroicGamesLauncherConfigPaths();
 
 std::vector<GameInstall> FindGameInstalls(
     const std::filesystem::path& heroicConfigPath,
@@ -0,0 +1,475 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/detection_cache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include "gui/hasher.h"
+#include "gui/state/game/detection/common.h"
+#include "gui/state/game/detection/detail.h"
+#include "gui/state/game/detection/epic_games_store.h"
+#include "gui/state/game/detection/heroic.h"
+#include "gui/state/game/detection/steam.h"
+#include "gui/state/game/game_settings.h"
+#include "gui/state/logging.h"
+
+namespace {
+using loot::GameInstall;
+using loot::Hasher;
+using loot::RegistryInterface;
+using loot::RegistryValue;
+
+constexpr uint32_t LDTC_MAGIC_NUMBER = 0x4354444C;
+constexpr uint8_t LDTC_FORMAT_VERSION = 1;
+
+// The Registry values and keys and the filesystem paths that were read to
+// find a set of game installs.
+struct DetectionSources {
+  std::vector<RegistryValue> registryValues;
+  std::vector<std::pair<std::string, std::string>> registrySubKeys;
+  std::vector<std::filesystem::path> paths;
+};
+
+struct DetectionCache {
+  uint64_t sourcesHash{0};
+  DetectionSources sources;
+  std::vector<GameInstall> installs;
+};
+
+// Don't care about endianness because the files don't need to be portable.
+template<typename T>
+T read(std::istream& in) {
+  T value{0};
+  in.read(reinterpret_cast<char*>(&value), sizeof value);
+
+  return value;
+}
+
+template<typename T>
+void write(std::ostream& out, T value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+std::string readString(std::istream& in) {
+  const auto length = read<uint32_t>(in);
+  if (!in.good()) {
+    return std::string();
+  }
+
+  std::string value(length, '\0');
+  in.read(value.data(), length);
+
+  return value;
+}
+
+void writeString(std::ostream& out, const std::string& value) {
+  write(out, static_cast<uint32_t>(value.size()));
+  out.write(value.data(), value.size());
+}
+
+// Hash the path's last write time, and its size if it's a file, or that it
+// doesn't exist. Unlike Hasher::AddFileState(), this also detects
+// entries being added to or removed from a directory.
+void AddPathState(Hasher& hasher, const std::filesystem::path& path) {
+  std::error_code errorCode;
+  const auto status = std::filesystem::status(path, errorCode);
+  if (!std::filesystem::exists(status)) {
+    hasher.Add(uint64_t{0});
+    return;
+  }
+
+  const auto lastWriteTime = std::filesystem::last_write_time(path, errorCode);
+  if (errorCode) {
+    hasher.Add(uint64_t{0});
+    return;
+  }
+
+  uint64_t size = 0;
+  if (std::filesystem::is_regular_file(status)) {
+    size = static_cast<uint64_t>(std::filesystem::file_size(path, errorCode));
+  }
+
+  hasher.Add(uint64_t{1});
+  hasher.Add(size);
+  hasher.Add(static_cast<uint64_t>(lastWriteTime.time_since_epoch().count()));
+}
+
+// On Windows, detection also checks if LOOT is installed in a subdirectory of
+// a game's install path, which depends on the current working directory.
+std::optional<std::filesystem::path> GetSiblingGamePath() {
+#ifdef _WIN32
+  return std::filesystem::current_path().parent_path();
+#else
+  return std::nullopt;
+#endif
+}
+
+uint64_t HashDetectionSources(
+    const DetectionSources& sources,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  Hasher hasher;
+
+  // The function's other inputs affect what is found.
+  hasher.Add(uint64_t{heroicConfigPaths.size()});
+  for (const auto& path : heroicConfigPaths) {
+    hasher.Add(path.u8string());
+  }
+
+  hasher.Add(uint64_t{xboxGamingRootPaths.size()});
+  for (const auto& path : xboxGamingRootPaths) {
+    hasher.Add(path.u8string());
+  }
+
+  hasher.Add(uint64_t{preferredUILanguages.size()});
+  for (const auto& language : preferredUILanguages) {
+    hasher.Add(language);
+  }
+
+  // The sibling path's state is recorded in the source paths, but the path
+  // itself isn't read from anywhere that is.
+  const auto siblingGamePath = GetSiblingGamePath();
+  hasher.Add(uint64_t{siblingGamePath.has_value()});
+  if (siblingGamePath.has_value()) {
+    hasher.Add(siblingGamePath.value().u8string());
+  }
+
+  for (const auto& value : sources.registryValues) {
+    const auto result = registry.GetStringValue(value);
+
+    hasher.Add(uint64_t{result.has_value()});
+    if (result.has_value()) {
+      hasher.Add(result.value());
+    }
+  }
+
+  for (const auto& [rootKey, subKey] : sources.registrySubKeys) {
+    const auto subKeys = registry.GetSubKeys(rootKey, subKey);
+
+    hasher.Add(uint64_t{subKeys.size()});
+    for (const auto& key : subKeys) {
+      hasher.Add(key);
+    }
+  }
+
+  for (const auto& path : sources.paths) {
+    AddPathState(hasher, path);
+  }
+
+  return hasher.GetHash();
+}
+
+// Most detection reads paths that are found using the Registry, and the
+// Registry values are recorded separately, but the paths of the files and
+// directories that it reads need to be listed here.
+std::vector<std::filesystem::path> GetDetectionSourcePaths(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<GameInstall>& installs) {
+  std::vector<std::filesystem::path> paths;
+
+  for (const auto& steamInstallPath :
+       loot::steam::GetSteamInstallPaths(registry)) {
+    paths.push_back(steamInstallPath / "config" / "libraryfolders.vdf");
+
+    for (const auto& manifestPath :
+         loot::steam::GetSteamAppManifestPaths(steamInstallPath)) {
+      paths.push_back(manifestPath);
+    }
+  }
+
+  for (const auto& heroicConfigPath : heroicConfigPaths) {
+    const auto snapshot = loot::heroic::HeroicSnapshot::Get(heroicConfigPath);
+    const auto sourcePaths = snapshot->GetSourcePaths();
+    paths.insert(paths.end(), sourcePaths.begin(), sourcePaths.end());
+  }
+
+  const auto egsManifestsPath = loot::epic::GetEgsManifestsPath(registry);
+  if (egsManifestsPath.has_value()) {
+    paths.push_back(egsManifestsPath.value());
+  }
+
+  // Microsoft Store games are installed in subdirectories of these paths.
+  paths.insert(
+      paths.end(), xboxGamingRootPaths.begin(), xboxGamingRootPaths.end());
+
+  // A game installed in the sibling path has its executable in that path and
+  // its master file in its plugins folder.
+  const auto siblingGamePath = GetSiblingGamePath();
+  if (siblingGamePath.has_value()) {
+    paths.push_back(siblingGamePath.value());
+
+    for (const auto gameId : loot::ALL_GAME_IDS) {
+      const auto pluginsPath =
+          siblingGamePath.value() /
+          std::filesystem::u8path(loot::GetPluginsFolderName(gameId));
+      if (std::find(paths.begin(), paths.end(), pluginsPath) == paths.end()) {
+        paths.push_back(pluginsPath);
+      }
+    }
+  }
+
+  // Check that the installs that were found haven't been removed.
+  for (const auto& install : installs) {
+    paths.push_back(install.installPath);
+    if (!install.localPath.empty()) {
+      paths.push_back(install.localPath);
+    }
+  }
+
+  return paths;
+}
+
+std::optional<DetectionCache> LoadDetectionCache(
+    const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return std::nullopt;
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  if (read<uint32_t>(in) != LDTC_MAGIC_NUMBER) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": wrong magic number");
+  }
+
+  if (read<uint8_t>(in) != LDTC_FORMAT_VERSION) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": unrecognised format version");
+  }
+
+  DetectionCache cache;
+  cache.sourcesHash = read<uint64_t>(in);
+
+  const auto valuesCount = read<uint32_t>(in);
+  for (uint32_t i = 0; i < valuesCount && in.good(); i += 1) {
+    RegistryValue value;
+    value.rootKey = readString(in);
+    value.subKey = readString(in);
+    value.valueName = readString(in);
+    cache.sources.registryValues.push_back(std::move(value));
+  }
+
+  const auto subKeysCount = read<uint32_t>(in);
+  for (uint32_t i = 0; i < subKeysCount && in.good(); i += 1) {
+    auto rootKey = readString(in);
+    auto subKey = readString(in);
+    cache.sources.registrySubKeys.emplace_back(std::move(rootKey),
+                                               std::move(subKey));
+  }
+
+  const auto pathsCount = read<uint32_t>(in);
+  for (uint32_t i = 0; i < pathsCount && in.good(); i += 1) {
+    cache.sources.paths.push_back(std::filesystem::u8path(readString(in)));
+  }
+
+  const auto installsCount = read<uint32_t>(in);
+  for (uint32_t i = 0; i < installsCount && in.good(); i += 1) {
+    GameInstall install;
+    install.gameId = static_cast<loot::GameId>(read<uint8_t>(in));
+    install.source = static_cast<loot::InstallSource>(read<uint8_t>(in));
+    install.installPath = std::filesystem::u8path(readString(in));
+    install.localPath = std::filesystem::u8path(readString(in));
+    cache.installs.push_back(std::move(install));
+  }
+
+  if (in.fail()) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": unexpected end of file");
+  }
+
+  return cache;
+}
+
+void SaveDetectionCache(const std::filesystem::path& filePath,
+                        const DetectionCache& cache) {
+  // Write to a temporary file and then replace the cache with it, so that an
+  // interrupted write can't leave behind a truncated cache.
+  auto tempPath = filePath;
+  tempPath += ".tmp";
+
+  std::ofstream out(
+      tempPath,
+      std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(tempPath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  write(out, LDTC_MAGIC_NUMBER);
+  write(out, LDTC_FORMAT_VERSION);
+  write(out, cache.sourcesHash);
+
+  write(out, static_cast<uint32_t>(cache.sources.registryValues.size()));
+  for (const auto& value : cache.sources.registryValues) {
+    writeString(out, value.rootKey);
+    writeString(out, value.subKey);
+    writeString(out, value.valueName);
+  }
+
+  write(out, static_cast<uint32_t>(cache.sources.registrySubKeys.size()));
+  for (const auto& [rootKey, subKey] : cache.sources.registrySubKeys) {
+    writeString(out, rootKey);
+    writeString(out, subKey);
+  }
+
+  write(out, static_cast<uint32_t>(cache.sources.paths.size()));
+  for (const auto& path : cache.sources.paths) {
+    writeString(out, path.u8string());
+  }
+
+  write(out, static_cast<uint32_t>(cache.installs.size()));
+  for (const auto& install : cache.installs) {
+    write(out, static_cast<uint8_t>(install.gameId));
+    write(out, static_cast<uint8_t>(install.source));
+    writeString(out, install.installPath.u8string());
+    writeString(out, install.localPath.u8string());
+  }
+
+  out.close();
+  if (out.fail()) {
+    throw std::runtime_error("Failed to write " + tempPath.u8string());
+  }
+
+  std::filesystem::rename(tempPath, filePath);
+}
+}
+
+namespace loot {
+RecordingRegistry::RecordingRegistry(const RegistryInterface& registry) :
+    registry_(registry) {}
+
+std::optional<std::string> RecordingRegistry::GetStringValue(
+    const RegistryValue& value) const {
+  const auto isRecorded = std::any_of(
+      queriedValues_.begin(),
+      queriedValues_.end(),
+      [&](const RegistryValue& queriedValue) {
+        return queriedValue.rootKey == value.rootKey &&
+               queriedValue.subKey == value.subKey &&
+               queriedValue.valueName == value.valueName;
+      });
+  if (!isRecorded) {
+    queriedValues_.push_back(value);
+  }
+
+  return registry_.GetStringValue(value);
+}
+
+std::vector<std::string> RecordingRegistry::GetSubKeys(
+    const std::string& rootKey,
+    const std::string& subKey) const {
+  const auto key = std::make_pair(rootKey, subKey);
+  if (std::find(queriedSubKeys_.begin(), queriedSubKeys_.end(), key) ==
+      queriedSubKeys_.end()) {
+    queriedSubKeys_.push_back(key);
+  }
+
+  return registry_.GetSubKeys(rootKey, subKey);
+}
+
+const std::vector<RegistryValue>& RecordingRegistry::GetQueriedValues() const {
+  return queriedValues_;
+}
+
+const std::vector<std::pair<std::string, std::string>>&
+RecordingRegistry::GetQueriedSubKeys() const {
+  return queriedSubKeys_;
+}
+
+std::vector<GameInstall> FindGameInstalls(
+    const std::filesystem::path& cachePath,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  const auto logger = getLogger();
+
+  try {
+    const auto cache = LoadDetectionCache(cachePath);
+    if (cache.has_value()) {
+      const auto sourcesHash = HashDetectionSources(cache.value().sources,
+                                                    registry,
+                                                    heroicConfigPaths,
+                                                    xboxGamingRootPaths,
+                                                    preferredUILanguages);
+
+      if (sourcesHash == cache.value().sourcesHash) {
+        if (logger) {
+          logger->debug(
+              "Nothing that game detection reads has changed since the "
+              "detection cache was written, using its installs.");
+        }
+        return cache.value().installs;
+      }
+    }
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->warn("Failed to read the game detection cache. Details: {}",
+                   e.what());
+    }
+  }
+
+  const RecordingRegistry recordingRegistry(registry);
+
+  DetectionCache cache;
+  cache.installs = FindGameInstalls(recordingRegistry,
+                                    heroicConfigPaths,
+                                    xboxGamingRootPaths,
+                                    preferredUILanguages);
+  cache.sources.paths = GetDetectionSourcePaths(recordingRegistry,
+                                                heroicConfigPaths,
+                                                xboxGamingRootPaths,
+                                                cache.installs);
+  cache.sources.registryValues = recordingRegistry.GetQueriedValues();
+  cache.sources.registrySubKeys = recordingRegistry.GetQueriedSubKeys();
+  cache.sourcesHash = HashDetectionSources(cache.sources,
+                                           registry,
+                                           heroicConfigPaths,
+                                           xboxGamingRootPaths,
+                                           preferredUILanguages);
+
+  try {
+    SaveDetectionCache(cachePath, cache);
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->warn("Failed to write the game detection cache. Details: {}",
+                   e.what());
+    }
+  }
+
+  return cache.installs;
+}
+}
@@ -0,0 +1,74 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_DETECTION_CACHE
+#define LOOT_GUI_STATE_GAME_DETECTION_CACHE
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gui/state/game/detection/game_install.h"
+#include "gui/state/game/detection/registry.h"
+
+namespace loot {
+// Records the Registry queries made through it, so that they can be repeated
+// later to check if their results have changed. Queries are recorded without
+// any locking, so an instance must only be used by one thread at a time.
+class RecordingRegistry : public RegistryInterface {
+public:
+  explicit RecordingRegistry(const RegistryInterface& registry);
+
+  std::optional<std::string> GetStringValue(
+      const RegistryValue& value) const override;
+
+  std::vector<std::string> GetSubKeys(const std::string& rootKey,
+                                      const std::string& subKey) const override;
+
+  const std::vector<RegistryValue>& GetQueriedValues() const;
+  const std::vector<std::pair<std::string, std::string>>& GetQueriedSubKeys()
+      const;
+
+private:
+  const RegistryInterface& registry_;
+  mutable std::vector<RegistryValue> queriedValues_;
+  mutable std::vector<std::pair<std::string, std::string>> queriedSubKeys_;
+};
+
+// Finds game installs, reusing the installs cached at the given path by a
+// previous call if the Registry values and filesystem paths that detection
+// read to find them are unchanged. Otherwise, all installs are detected again
+// and the cache is replaced.
+std::vector<GameInstall> FindGameInstalls(
+    const std::filesystem::path& cachePath,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages);
+}
+
+#endif
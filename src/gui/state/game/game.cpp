@@ -29,6 +29,7 @@
 #include <cmath>
 #include <execution>
 #include <fstream>
+#include <regex>
 #include <unordered_set>
 
 #ifdef _WIN32
@@ -51,12 +52,16 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
 
+#include "gui/hasher.h"
 #include "gui/helpers.h"
+#include "gui/message_templates.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/generic.h"
 #include "gui/state/game/helpers.h"
+#include "gui/state/game/sort_cache.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/version.h"
 #include "loot/exception/file_access_error.h"
 #include "loot/exception/undefined_group_error.h"
 
@@ -90,6 +95,35 @@ bool IsPathCaseSensitive(const std::filesystem::path& path) {
   std::error_code errorCode;
   return !std::filesystem::equivalent(lowercased, uppercased, errorCode);
 }
+
+// Conditions can test any file in or relative to the data path, but installed
+// plugins are the only files whose states are hashed as sort inputs.
+bool IsInstalledPluginPath(const std::string& path) {
+  if (path.find('/') != std::string::npos || boost::starts_with(path, "..")) {
+    return false;
+  }
+
+  return loot::HasPluginFileExtension(path);
+}
+
+bool HasConditionOnNonPluginFile(const std::vector<loot::File>& files) {
+  // Every condition function takes a quoted path as its first argument.
+  static const std::regex PATH_ARGUMENT_REGEX(R"re(\w+\(\s*"([^"]+)")re");
+
+  for (const auto& file : files) {
+    const auto condition = file.GetCondition();
+    for (std::sregex_iterator it(
+             condition.begin(), condition.end(), PATH_ARGUMENT_REGEX);
+         it != std::sregex_iterator();
+         ++it) {
+      if (!IsInstalledPluginPath((*it)[1].str())) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
 }
 
 namespace loot {
@@ -213,6 +247,20 @@ std::string GetDisplayName(const File& file) {
   return file.GetDisplayName();
 }
 
+void UserMetadataTransaction::SetUserGroups(const std::vector<Group>& groups) {
+  userGroups_ = groups;
+}
+
+void UserMetadataTransaction::ReplaceUserMetadata(
+    const PluginMetadata& metadata) {
+  pluginEdits_.push_back(metadata);
+}
+
+void UserMetadataTransaction::SetPluginGroup(const std::string& pluginName,
+                                             const std::string& groupName) {
+  pluginEdits_.push_back(PluginGroupEdit{pluginName, groupName});
+}
+
 Game::Game(const GameSettings& gameSettings,
            const std::filesystem::path& lootDataPath,
            const std::filesystem::path& preludePath) :
@@ -225,24 +273,42 @@ Game::Game(const GameSettings& gameSettings,
 Game::Game(Game&& game) {
   settings_ = std::move(game.settings_);
   gameHandle_ = std::move(game.gameHandle_);
+  userlistWriter_ = std::move(game.userlistWriter_);
+  userMetadataWriteErrorHandler_ =
+      std::move(game.userMetadataWriteErrorHandler_);
   messages_ = std::move(game.messages_);
   lootDataPath_ = std::move(game.lootDataPath_);
   preludePath_ = std::move(game.preludePath_);
   loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
   pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
+  pluginsLoadCount_ = std::move(game.pluginsLoadCount_);
+  prefetchedPluginsHandles_ = std::move(game.prefetchedPluginsHandles_);
   isMicrosoftStoreInstall_ = std::move(game.isMicrosoftStoreInstall_);
+  metadataListsHash_ = std::move(game.metadataListsHash_);
+  bashTagsFiles_ = std::move(game.bashTagsFiles_);
+  stringPool_ = std::move(game.stringPool_);
 }
 
 Game& Game::operator=(Game&& game) {
   if (&game != this) {
     settings_ = std::move(game.settings_);
+    // Replace the userlist writer first, as the existing writer may still
+    // reference the existing game handle's database.
+    userlistWriter_ = std::move(game.userlistWriter_);
+    userMetadataWriteErrorHandler_ =
+        std::move(game.userMetadataWriteErrorHandler_);
     gameHandle_ = std::move(game.gameHandle_);
     messages_ = std::move(game.messages_);
     lootDataPath_ = std::move(game.lootDataPath_);
     preludePath_ = std::move(game.preludePath_);
     loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
     pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
+    pluginsLoadCount_ = std::move(game.pluginsLoadCount_);
+    prefetchedPluginsHandles_ = std::move(game.prefetchedPluginsHandles_);
     isMicrosoftStoreInstall_ = std::move(game.isMicrosoftStoreInstall_);
+    metadataListsHash_ = std::move(game.metadataListsHash_);
+    bashTagsFiles_ = std::move(game.bashTagsFiles_);
+    stringPool_ = std::move(game.stringPool_);
   }
 
   return *this;
@@ -263,11 +329,22 @@ void Game::Init() {
   messages_.clear();
   loadOrderSortCount_ = 0;
   pluginsFullyLoaded_ = false;
+  pluginsLoadCount_ += 1;
+  prefetchedPluginsHandles_.clear();
+  bashTagsFiles_.clear();
+
+  // Finish writing any user metadata from the existing game handle before
+  // replacing it.
+  userlistWriter_.reset();
 
   gameHandle_ = CreateGameHandle(
       settings_.Type(), settings_.GamePath(), settings_.GameLocalPath());
   gameHandle_->IdentifyMainMasterFile(settings_.Master());
 
+  userlistWriter_ = std::make_unique<UserlistWriter>(
+      gameHandle_->GetDatabase(), UserlistPath());
+  userlistWriter_->SetErrorHandler(userMetadataWriteErrorHandler_);
+
   InitLootGameFolder(lootDataPath_, settings_);
 }
 
@@ -311,11 +388,8 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           messages.push_back(CreatePlainTextSourcedMessage(
               MessageType::error,
               MessageSource::missingMaster,
-              fmt::format(
-                  boost::locale::translate("This plugin requires \"{0}\" to be "
-                                           "installed, but it is missing.")
-                      .str(),
-                  master)));
+              fmt::format(GetMessageTemplate(MessageTemplateId::missingFile),
+                          master)));
         } else if (!IsPluginActive(master)) {
           if (logger) {
             logger->error("\"{}\" requires \"{}\", but it is inactive.",
@@ -325,11 +399,8 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           messages.push_back(CreatePlainTextSourcedMessage(
               MessageType::error,
               MessageSource::inactiveMaster,
-              fmt::format(
-                  boost::locale::translate("This plugin requires \"{0}\" to be "
-                                           "active, but it is inactive.")
-                      .str(),
-                  master)));
+              fmt::format(GetMessageTemplate(MessageTemplateId::inactiveMaster),
+                          master)));
         }
       }
     }
@@ -356,10 +427,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
         }
 
         auto localisedText = fmt::format(
-            boost::locale::translate("This plugin requires \"{0}\" to be "
-                                     "installed, but it is missing.")
-                .str(),
-            displayName);
+            GetMessageTemplate(MessageTemplateId::missingFile), displayName);
         auto detailContent = SelectMessageContent(req.GetDetail(), language);
         auto messageText =
             detailContent.has_value()
@@ -397,10 +465,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
         }
 
         auto localisedText = fmt::format(
-            boost::locale::translate(
-                "This plugin is incompatible with \"{0}\", but both "
-                "are present.")
-                .str(),
+            GetMessageTemplate(MessageTemplateId::incompatibleFile),
             displayName);
         auto detailContent = SelectMessageContent(inc.GetDetail(), language);
         auto messageText =
@@ -443,14 +508,9 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
         messages.push_back(CreatePlainTextSourcedMessage(
             MessageType::error,
             MessageSource::lightPluginRequiresNonMaster,
-            fmt::format(
-                boost::locale::translate(
-                    "This plugin is a light master and requires the non-master "
-                    "plugin \"{0}\". This can cause issues in-game, and "
-                    "sorting "
-                    "will fail while this plugin is installed.")
-                    .str(),
-                masterName)));
+            fmt::format(GetMessageTemplate(
+                            MessageTemplateId::lightMasterRequiresNonMaster),
+                        masterName)));
       }
     }
   }
@@ -466,10 +526,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     messages.push_back(CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::invalidLightPlugin,
-        boost::locale::translate(
-            "This plugin contains records that have FormIDs outside "
-            "the valid range for an ESL plugin. Using this plugin "
-            "will cause irreversible damage to your game saves.")));
+        GetMessageTemplate(MessageTemplateId::invalidLightPlugin)));
   }
 
   if (plugin.GetHeaderVersion().has_value() &&
@@ -485,15 +542,9 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     messages.push_back(CreatePlainTextSourcedMessage(
         MessageType::warn,
         MessageSource::invalidHeaderVersion,
-        fmt::format(
-            boost::locale::translate(
-                /* translators: A header is the part of a file that stores data
-                   like file name and version. */
-                "This plugin has a header version of {0}, which is less than "
-                "the game's minimum supported header version of {1}.")
-                .str(),
-            plugin.GetHeaderVersion().value(),
-            settings_.MinimumHeaderVersion())));
+        fmt::format(GetMessageTemplate(MessageTemplateId::invalidHeaderVersion),
+                    plugin.GetHeaderVersion().value(),
+                    settings_.MinimumHeaderVersion())));
   }
 
   if (metadata.GetGroup().has_value()) {
@@ -508,18 +559,14 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
       messages.push_back(CreatePlainTextSourcedMessage(
           MessageType::error,
           MessageSource::missingGroup,
-          fmt::format(
-              boost::locale::translate("This plugin belongs to the group "
-                                       "\"{0}\", which does not exist.")
-                  .str(),
-              groupName)));
+          fmt::format(GetMessageTemplate(MessageTemplateId::missingGroup),
+                      groupName)));
     }
   }
 
   const auto lootTags = metadata.GetTags();
   if (!lootTags.empty()) {
-    const auto bashTagFileTags =
-        ReadBashTagsFile(settings_.DataPath(), metadata.GetName());
+    const auto bashTagFileTags = GetBashTagsFileTags(metadata.GetName());
     const auto conflictingTags = GetTagConflicts(lootTags, bashTagFileTags);
     if (!conflictingTags.empty()) {
       const auto commaSeparatedTags = boost::join(conflictingTags, ", ");
@@ -533,12 +580,8 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
       messages.push_back(CreatePlainTextSourcedMessage(
           MessageType::say,
           MessageSource::bashTagsOverride,
-          fmt::format(
-              boost::locale::translate(
-                  "This plugin has a BashTags file that will override the "
-                  "suggestions made by LOOT for the following Bash Tags: {0}.")
-                  .str(),
-              commaSeparatedTags)));
+          fmt::format(GetMessageTemplate(MessageTemplateId::bashTagsOverride),
+                      commaSeparatedTags)));
     }
   }
 
@@ -623,6 +666,134 @@ void Game::LoadCreationClubPluginNames() {
 }
 
 void Game::LoadAllInstalledPlugins(bool headersOnly) {
+  LoadCurrentLoadOrderState();
+
+  const auto installedPluginPaths = GetInstalledPluginPaths(
+      *gameHandle_, settings_, isMicrosoftStoreInstall_);
+  gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+
+  // Check if any plugins have been removed.
+  std::vector<std::string> loadedPluginNames;
+  for (auto plugin : gameHandle_->GetLoadedPlugins()) {
+    loadedPluginNames.push_back(plugin->GetName());
+  }
+
+  AppendMessages(
+      CheckForRemovedPlugins(installedPluginPaths, loadedPluginNames));
+
+  LoadBashTagsFiles();
+
+  pluginsFullyLoaded_ = !headersOnly;
+
+  // Any prefetched plugins may now be out of date, and aren't needed if the
+  // plugins were fully loaded anyway.
+  pluginsLoadCount_ += 1;
+  prefetchedPluginsHandles_.clear();
+}
+
+bool Game::ArePluginsFullyLoaded() const {
+  return pluginsFullyLoaded_ || !prefetchedPluginsHandles_.empty();
+}
+
+std::function<std::optional<PrefetchedPlugins>(const std::atomic<bool>&)>
+Game::CreatePluginsPrefetcher() const {
+  return [settings = settings_,
+          isMicrosoftStoreInstall = isMicrosoftStoreInstall_,
+          pluginsLoadCount = pluginsLoadCount_](
+             const std::atomic<bool>& isCancelled)
+             -> std::optional<PrefetchedPlugins> {
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug("Prefetching fully loaded plugins for {}",
+                    settings.Name());
+    }
+
+    const auto createGameHandle = [&settings]() {
+      auto gameHandle = CreateGameHandle(
+          settings.Type(), settings.GamePath(), settings.GameLocalPath());
+      gameHandle->IdentifyMainMasterFile(settings.Master());
+      return gameHandle;
+    };
+
+    auto gameHandle = createGameHandle();
+
+    if (isCancelled) {
+      return std::nullopt;
+    }
+
+    const auto pluginPaths = GetInstalledPluginPaths(
+        *gameHandle, settings, isMicrosoftStoreInstall);
+
+    // Loading a batch can't be interrupted, so keep batches small enough
+    // that a cancelled prefetch stops soon after it's cancelled.
+    static constexpr size_t PREFETCH_BATCH_SIZE = 32;
+
+    PrefetchedPlugins prefetchedPlugins{settings.FolderName(),
+                                        pluginsLoadCount};
+    for (size_t i = 0; i < pluginPaths.size(); i += PREFETCH_BATCH_SIZE) {
+      if (isCancelled) {
+        return std::nullopt;
+      }
+
+      if (!gameHandle) {
+        gameHandle = createGameHandle();
+      }
+
+      const auto batchEnd =
+          std::min(pluginPaths.size(), i + PREFETCH_BATCH_SIZE);
+      const std::vector<std::string> batch(pluginPaths.begin() + i,
+                                           pluginPaths.begin() + batchEnd);
+
+      gameHandle->LoadPlugins(batch, false);
+      prefetchedPlugins.gameHandles.push_back(std::move(gameHandle));
+    }
+
+    if (isCancelled) {
+      return std::nullopt;
+    }
+
+    if (logger) {
+      logger->debug("Finished prefetching fully loaded plugins for {}",
+                    settings.Name());
+    }
+
+    return prefetchedPlugins;
+  };
+}
+
+void Game::SetPrefetchedPlugins(PrefetchedPlugins&& prefetchedPlugins) {
+  if (prefetchedPlugins.gameFolderName != settings_.FolderName() ||
+      prefetchedPlugins.pluginsLoadCount != pluginsLoadCount_ ||
+      pluginsFullyLoaded_) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug("Discarding out-of-date prefetched plugins");
+    }
+    return;
+  }
+
+  prefetchedPluginsHandles_ = std::move(prefetchedPlugins.gameHandles);
+}
+
+void Game::DiscardPrefetchedPlugins() { prefetchedPluginsHandles_.clear(); }
+
+const PluginInterface* Game::GetFullyLoadedPlugin(
+    const std::string& name) const {
+  if (pluginsFullyLoaded_) {
+    return gameHandle_->GetPlugin(name);
+  }
+
+  for (const auto& gameHandle : prefetchedPluginsHandles_) {
+    const auto plugin = gameHandle->GetPlugin(name);
+    if (plugin) {
+      return plugin;
+    }
+  }
+
+  return nullptr;
+}
+
+void Game::LoadCurrentLoadOrderState() {
   try {
     gameHandle_->LoadCurrentLoadOrderState();
   } catch (const std::exception& e) {
@@ -637,24 +808,35 @@ void Game::LoadAllInstalledPlugins(bool headersOnly) {
                                  "information displayed may be incorrect.")
             .str()));
   }
+}
 
-  const auto installedPluginPaths = GetInstalledPluginPaths();
-  gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+void Game::LoadBashTagsFiles() {
+  bashTagsFiles_ = ReadBashTagsFiles(settings_.DataPath());
+}
 
-  // Check if any plugins have been removed.
-  std::vector<std::string> loadedPluginNames;
-  for (auto plugin : gameHandle_->GetLoadedPlugins()) {
-    loadedPluginNames.push_back(plugin->GetName());
+std::vector<std::filesystem::path> Game::GetPluginsDirectoryPaths() const {
+  auto paths = GetExternalDataPaths(
+      settings_.Id(), isMicrosoftStoreInstall_, settings_.DataPath());
+  paths.push_back(settings_.DataPath());
+
+  return paths;
+}
+
+std::vector<std::filesystem::path> Game::GetLoadOrderFilePaths() const {
+  // Games with timestamp-based load orders store them in the plugin files
+  // themselves, so there's nothing extra to include for them.
+  if (settings_.Type() == GameType::tes3) {
+    return {settings_.GamePath() / "Morrowind.ini"};
   }
 
-  AppendMessages(
-      CheckForRemovedPlugins(installedPluginPaths, loadedPluginNames));
+  const auto gameLocalPath = settings_.GameLocalPath();
+  if (gameLocalPath.empty()) {
+    return {};
+  }
 
-  pluginsFullyLoaded_ = !headersOnly;
+  return {gameLocalPath / "plugins.txt", gameLocalPath / "loadorder.txt"};
 }
 
-bool Game::ArePluginsFullyLoaded() const { return pluginsFullyLoaded_; }
-
 fs::path Game::MasterlistPath() const {
   return GetMasterlistPath(lootDataPath_, settings_);
 }
@@ -714,7 +896,7 @@ bool Game::IsLoadOrderAmbiguous() const {
   return gameHandle_->IsLoadOrderAmbiguous();
 }
 
-std::vector<std::string> Game::SortPlugins() {
+SortPreparation Game::PrepareForSorting() {
   auto logger = getLogger();
 
   try {
@@ -731,18 +913,74 @@ std::vector<std::string> Game::SortPlugins() {
             .str()));
   }
 
+  SortPreparation preparation;
+  preparation.loadOrder = gameHandle_->GetLoadOrder();
+  for (const auto& pluginName : preparation.loadOrder) {
+    preparation.pluginPaths.push_back(
+        ResolveGameFilePath(pluginName).u8string());
+  }
+  preparation.pluginsHash =
+      GetPluginsSortInputsHash(preparation.loadOrder, preparation.pluginPaths);
+
+  return preparation;
+}
+
+std::vector<std::string> Game::SortPlugins() {
+  return SortPlugins([this]() { return PrepareForSorting(); });
+}
+
+std::vector<std::string> Game::SortPlugins(
+    const SortPreparation& preparation) {
+  return SortPlugins([&preparation]() { return preparation; });
+}
+
+std::vector<std::string> Game::SortPlugins(
+    const std::function<SortPreparation()>& prepare) {
+  auto logger = getLogger();
+
   std::vector<std::string> sortedPlugins;
   try {
+    const auto preparation = prepare();
+
     // Clear any existing game-specific messages, as these only relate to
     // state that has been changed by sorting.
     ClearMessages();
 
-    std::vector<std::string> pluginPaths;
-    for (const auto& pluginName : gameHandle_->GetLoadOrder()) {
-      pluginPaths.push_back(ResolveGameFilePath(pluginName).u8string());
+    const auto& pluginPaths = preparation.pluginPaths;
+    const auto useSortCache =
+        !DoesSortDependOnNonPluginFiles(preparation.loadOrder);
+    uint64_t sortInputsHash = 0;
+    std::optional<std::vector<std::string>> cachedSortResult;
+
+    if (useSortCache) {
+      sortInputsHash = GetSortInputsHash(preparation.pluginsHash);
+      cachedSortResult = GetCachedSortResult(sortInputsHash);
+    } else if (logger) {
+      logger->debug(
+          "Sorting depends on the state of files that are not plugins, not "
+          "using the sort cache.");
     }
 
-    sortedPlugins = gameHandle_->SortPlugins(pluginPaths);
+    if (cachedSortResult.has_value()) {
+      if (logger) {
+        logger->info(
+            "Nothing that affects sorting has changed since a previous sort, "
+            "using its result.");
+      }
+
+      // Sorting fully loads the plugins, and some of the checks that are run
+      // on the sorted plugins give different results for plugins that have
+      // only had their headers loaded, so load them as sorting would.
+      gameHandle_->LoadPlugins(pluginPaths, false);
+
+      sortedPlugins = cachedSortResult.value();
+    } else {
+      sortedPlugins = gameHandle_->SortPlugins(pluginPaths);
+
+      if (useSortCache) {
+        CacheSortResult(sortInputsHash, sortedPlugins);
+      }
+    }
 
     AppendMessages(CheckForRemovedPlugins(pluginPaths, sortedPlugins));
 
@@ -807,8 +1045,7 @@ std::vector<SourcedMessage> Game::GetMessages(
 
   if (loadOrderSortCount_ == 0) {
     addWarning(MessageSource::unsortedLoadOrderCheck,
-               boost::locale::translate(
-                   "You have not sorted your load order this session."));
+               GetMessageTemplate(MessageTemplateId::unsortedLoadOrder));
   }
 
   size_t activeNormalPluginsCount = 0;
@@ -983,6 +1220,14 @@ void Game::AppendMessage(const SourcedMessage& message) {
 
 void Game::ClearMessages() { messages_.clear(); }
 
+InternedString Game::InternString(std::string_view value) const {
+  return stringPool_->Intern(value);
+}
+
+InternedString Game::InternOwnedString(const InternedString& value) const {
+  return stringPool_->InternOwned(value);
+}
+
 void Game::LoadMetadata() {
   auto logger = getLogger();
 
@@ -990,6 +1235,12 @@ void Game::LoadMetadata() {
   std::filesystem::path masterlistPath;
   std::filesystem::path userlistPath;
 
+  // Finish any scheduled userlist write first, so that the userlist isn't
+  // read before edits that were made to the user metadata in memory have been
+  // saved. Otherwise the edits would be lost, and the pending write would then
+  // save the stale userlist content.
+  FlushUserMetadata();
+
   if (std::filesystem::exists(preludePath_)) {
     if (logger) {
       logger->debug("Preparing to parse masterlist prelude.");
@@ -1014,7 +1265,17 @@ void Game::LoadMetadata() {
   if (logger) {
     logger->debug("Parsing metadata list(s).");
   }
+
+  // Strings from the previous metadata are unlikely to be needed again.
+  stringPool_->Clear();
+
+  Hasher metadataListsHasher;
+  metadataListsHasher.AddFileContent(masterlistPreludePath);
+  metadataListsHasher.AddFileContent(masterlistPath);
+  metadataListsHash_ = metadataListsHasher.GetHash();
+
   try {
+    const auto lock = userlistWriter_->LockDatabase();
     gameHandle_->GetDatabase().LoadLists(
         masterlistPath, userlistPath, masterlistPreludePath);
   } catch (const std::exception& e) {
@@ -1092,30 +1353,230 @@ std::optional<PluginMetadata> Game::GetUserMetadata(
 }
 
 void Game::SetUserGroups(const std::vector<Group>& groups) {
+  const auto lock = userlistWriter_->LockDatabase();
   return gameHandle_->GetDatabase().SetUserGroups(groups);
 }
 
 void Game::AddUserMetadata(const PluginMetadata& metadata) {
+  const auto lock = userlistWriter_->LockDatabase();
   gameHandle_->GetDatabase().SetPluginUserMetadata(metadata);
 }
 
 void Game::ClearUserMetadata(const std::string& pluginName) {
+  const auto lock = userlistWriter_->LockDatabase();
   gameHandle_->GetDatabase().DiscardPluginUserMetadata(pluginName);
 }
 
 void Game::ClearAllUserMetadata() {
+  const auto lock = userlistWriter_->LockDatabase();
   gameHandle_->GetDatabase().DiscardAllUserMetadata();
 }
 
-void Game::SaveUserMetadata() {
-  gameHandle_->GetDatabase().WriteUserMetadata(UserlistPath(), true);
+void Game::SaveUserMetadata() { userlistWriter_->ScheduleWrite(); }
+
+std::vector<std::string> Game::ApplyUserMetadataTransaction(
+    const UserMetadataTransaction& transaction) {
+  std::vector<std::string> pluginNames;
+  std::set<Filename> seenPluginNames;
+  for (const auto& edit : transaction.pluginEdits_) {
+    const auto& pluginName =
+        std::holds_alternative<PluginMetadata>(edit)
+            ? std::get<PluginMetadata>(edit).GetName()
+            : std::get<UserMetadataTransaction::PluginGroupEdit>(edit)
+                  .pluginName;
+
+    if (seenPluginNames.insert(Filename(pluginName)).second) {
+      pluginNames.push_back(pluginName);
+    }
+  }
+
+  {
+    const auto lock = userlistWriter_->LockDatabase();
+    auto& database = gameHandle_->GetDatabase();
+
+    // Record the existing user metadata so that it can be restored if an
+    // edit fails.
+    const auto previousUserGroups = database.GetUserGroups();
+    std::vector<std::pair<std::string, std::optional<PluginMetadata>>>
+        previousMetadata;
+    previousMetadata.reserve(pluginNames.size());
+    for (const auto& pluginName : pluginNames) {
+      previousMetadata.emplace_back(
+          pluginName, database.GetPluginUserMetadata(pluginName));
+    }
+
+    try {
+      if (transaction.userGroups_.has_value()) {
+        database.SetUserGroups(transaction.userGroups_.value());
+      }
+
+      for (const auto& edit : transaction.pluginEdits_) {
+        if (std::holds_alternative<PluginMetadata>(edit)) {
+          const auto& metadata = std::get<PluginMetadata>(edit);
+          database.DiscardPluginUserMetadata(metadata.GetName());
+          if (!metadata.HasNameOnly()) {
+            database.SetPluginUserMetadata(metadata);
+          }
+        } else {
+          const auto& groupEdit =
+              std::get<UserMetadataTransaction::PluginGroupEdit>(edit);
+          auto metadata =
+              database.GetPluginUserMetadata(groupEdit.pluginName)
+                  .value_or(PluginMetadata(groupEdit.pluginName));
+          metadata.SetGroup(groupEdit.groupName);
+          database.SetPluginUserMetadata(metadata);
+        }
+      }
+    } catch (...) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->error(
+            "Failed to apply user metadata transaction, restoring the "
+            "previous user metadata.");
+      }
+
+      database.SetUserGroups(previousUserGroups);
+      for (const auto& [pluginName, metadata] : previousMetadata) {
+        database.DiscardPluginUserMetadata(pluginName);
+        if (metadata.has_value()) {
+          database.SetPluginUserMetadata(metadata.value());
+        }
+      }
+      throw;
+    }
+  }
+
+  SaveUserMetadata();
+
+  return pluginNames;
+}
+
+void Game::FlushUserMetadata() {
+  if (userlistWriter_) {
+    userlistWriter_->Flush();
+  }
+}
+
+void Game::SetUserMetadataWriteErrorHandler(
+    UserlistWriter::ErrorHandler handler) {
+  userMetadataWriteErrorHandler_ = std::move(handler);
+
+  if (userlistWriter_) {
+    userlistWriter_->SetErrorHandler(userMetadataWriteErrorHandler_);
+  }
+}
+
+std::filesystem::path Game::SortCachePath() const {
+  return GetLOOTGamePath() / "sort_cache.bin";
+}
+
+uint64_t Game::GetPluginsSortInputsHash(
+    const std::vector<std::string>& loadOrder,
+    const std::vector<std::string>& pluginPaths) const {
+  Hasher hasher;
+
+  // Plugins are identified by their size and last write time, as getting
+  // their CRCs would involve reading them.
+  for (size_t i = 0; i < loadOrder.size(); i += 1) {
+    hasher.Add(pluginPaths.at(i));
+    hasher.AddFileState(u8path(pluginPaths.at(i)));
+    hasher.Add(static_cast<uint64_t>(IsPluginActive(loadOrder.at(i))));
+  }
+
+  return hasher.GetHash();
+}
+
+uint64_t Game::GetSortInputsHash(uint64_t pluginsHash) {
+  // Make sure that the userlist file matches the user metadata in memory.
+  FlushUserMetadata();
+
+  Hasher hasher;
+
+  hasher.Add(gui::Version::string());
+  hasher.Add(gui::Version::revision);
+  hasher.Add(GetLiblootVersion());
+  hasher.Add(GetLiblootRevision());
+
+  hasher.Add(static_cast<uint64_t>(settings_.Type()));
+  hasher.Add(settings_.Master());
+  hasher.Add(settings_.GamePath().u8string());
+  hasher.Add(settings_.GameLocalPath().u8string());
+
+  hasher.Add(metadataListsHash_);
+  hasher.AddFileContent(UserlistPath());
+  hasher.Add(pluginsHash);
+
+  return hasher.GetHash();
+}
+
+bool Game::DoesSortDependOnNonPluginFiles(
+    const std::vector<std::string>& loadOrder) const {
+  // Only load after and requirement metadata affect sorting, and the only
+  // conditions on them that are covered by the sort inputs hash are those that
+  // test installed plugins. Other files (e.g. BSAs, DLLs and INIs) could be
+  // anywhere, so it's simpler not to cache the result.
+  for (const auto& pluginName : loadOrder) {
+    const auto metadata =
+        gameHandle_->GetDatabase().GetPluginMetadata(pluginName, true, false);
+    if (!metadata.has_value()) {
+      continue;
+    }
+
+    if (HasConditionOnNonPluginFile(metadata.value().GetLoadAfterFiles()) ||
+        HasConditionOnNonPluginFile(metadata.value().GetRequirements())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::optional<std::vector<std::string>> Game::GetCachedSortResult(
+    uint64_t sortInputsHash) const {
+  try {
+    auto sortedPlugins =
+        ::loot::GetCachedSortResult(SortCachePath(), sortInputsHash);
+
+    // The cached result can only be used if its plugins are loaded.
+    if (sortedPlugins.has_value() &&
+        std::all_of(sortedPlugins.value().begin(),
+                    sortedPlugins.value().end(),
+                    [&](const std::string& pluginName) {
+                      return gameHandle_->GetPlugin(pluginName) != nullptr;
+                    })) {
+      return sortedPlugins;
+    }
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->warn("Failed to read the sort cache. Details: {}", e.what());
+    }
+  }
+
+  return std::nullopt;
+}
+
+void Game::CacheSortResult(
+    uint64_t sortInputsHash,
+    const std::vector<std::string>& sortedPlugins) const {
+  try {
+    ::loot::CacheSortResult(SortCachePath(), sortInputsHash, sortedPlugins);
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->warn("Failed to write the sort cache. Details: {}", e.what());
+    }
+  }
 }
 
 std::filesystem::path Game::GetLOOTGamePath() const {
   return ::GetLOOTGamePath(lootDataPath_, settings_.FolderName());
 }
 
-std::vector<std::string> Game::GetInstalledPluginPaths() const {
+std::vector<std::string> Game::GetInstalledPluginPaths(
+    const GameInterface& gameHandle,
+    const GameSettings& settings,
+    bool isMicrosoftStoreInstall) {
   const auto logger = getLogger();
 
   // Checking to see if a plugin is valid is relatively slow, almost entirely
@@ -1127,7 +1588,7 @@ std::vector<std::string> Game::GetInstalledPluginPaths() const {
   // Scan external data paths first, as the game checks them before the main
   // data path.
   for (const auto& dataPath : GetExternalDataPaths(
-           settings_.Id(), isMicrosoftStoreInstall_, settings_.DataPath())) {
+           settings.Id(), isMicrosoftStoreInstall, settings.DataPath())) {
     if (!std::filesystem::exists(dataPath)) {
       continue;
     }
@@ -1152,10 +1613,10 @@ std::vector<std::string> Game::GetInstalledPluginPaths() const {
   // not the whole path, which simplifies the log/debugging.
   if (logger) {
     logger->trace("Scanning for plugins in {}",
-                  settings_.DataPath().u8string());
+                  settings.DataPath().u8string());
   }
 
-  for (fs::directory_iterator it(settings_.DataPath());
+  for (fs::directory_iterator it(settings.DataPath());
        it != fs::directory_iterator();
        ++it) {
     if (fs::is_regular_file(it->status())) {
@@ -1173,7 +1634,7 @@ std::vector<std::string> Game::GetInstalledPluginPaths() const {
                      maybePlugins.end(),
                      [&](const std::string& path) {
                        try {
-                         const auto isValid = gameHandle_->IsValidPlugin(path);
+                         const auto isValid = gameHandle.IsValidPlugin(path);
                          if (isValid && logger) {
                            logger->debug("Found plugin: {}", path);
                          }
@@ -1206,6 +1667,22 @@ std::filesystem::path Game::ResolveGameFilePath(
       externalDataPaths, settings_.DataPath(), filePath);
 }
 
+std::vector<Tag> Game::GetBashTagsFileTags(
+    const std::string& pluginName) const {
+  static constexpr size_t PLUGIN_EXTENSION_LENGTH = 4;
+  if (pluginName.length() < PLUGIN_EXTENSION_LENGTH) {
+    return {};
+  }
+
+  const auto it = bashTagsFiles_.find(Filename(
+      pluginName.substr(0, pluginName.length() - PLUGIN_EXTENSION_LENGTH)));
+  if (it == bashTagsFiles_.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
 bool Game::FileExists(const std::string& filePath) const {
   // OK to call this for non-plugin files too.
   auto resolvedPath = ResolveGameFilePath(filePath);
@@ -38,9 +38,11 @@
 #endif
 #endif
 
+#include <atomic>
 #include <execution>
 #include <filesystem>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -52,8 +54,10 @@
 #undef LOOT_SHOULD_REDEFINE_EMIT
 #endif
 
+#include "gui/interned_string.h"
 #include "gui/sourced_message.h"
 #include "gui/state/game/game_settings.h"
+#include "gui/state/game/userlist_writer.h"
 #include "gui/state/logging.h"
 #include "loot/api.h"
 
@@ -66,6 +70,46 @@ void InitLootGameFolder(const std::filesystem::path& lootDataPath_,
                         const GameSettings& settings);
 
 namespace gui {
+struct PrefetchedPlugins {
+  std::string gameFolderName;
+  unsigned int pluginsLoadCount{0};
+  // Loading plugins into a game handle replaces any that it had already
+  // loaded, so each batch of plugins is loaded into its own handle.
+  std::vector<std::unique_ptr<GameInterface>> gameHandles;
+};
+
+// The inputs to sorting that don't depend on the game's metadata.
+struct SortPreparation {
+  std::vector<std::string> loadOrder;
+  std::vector<std::string> pluginPaths;
+  uint64_t pluginsHash{0};
+};
+
+// A set of user metadata edits that are applied together by
+// Game::ApplyUserMetadataTransaction(). Edits are applied in the order in
+// which they were added.
+class UserMetadataTransaction {
+public:
+  void SetUserGroups(const std::vector<Group>& groups);
+  // Replaces any existing user metadata for the plugin, discarding it if the
+  // given metadata has nothing but a name.
+  void ReplaceUserMetadata(const PluginMetadata& metadata);
+  // Sets the plugin's group, preserving the rest of its user metadata.
+  void SetPluginGroup(const std::string& pluginName,
+                      const std::string& groupName);
+
+private:
+  friend class Game;
+
+  struct PluginGroupEdit {
+    std::string pluginName;
+    std::string groupName;
+  };
+
+  std::optional<std::vector<Group>> userGroups_;
+  std::vector<std::variant<PluginMetadata, PluginGroupEdit>> pluginEdits_;
+};
+
 class Game {
 public:
   Game(const GameSettings& gameSettings,
@@ -101,6 +145,33 @@ public:
   bool ArePluginsFullyLoaded()
       const;  // Checks if the game's plugins have already been loaded.
 
+  // Fully loading plugins is slow, so it can be done ahead of time using
+  // separate game handles, leaving the plugins used by everything else
+  // untouched. The returned function doesn't reference this object, so it
+  // can be run on another thread. It loads plugins in batches, checking for
+  // cancellation between them, and returns nullopt if it gets cancelled.
+  std::function<std::optional<PrefetchedPlugins>(const std::atomic<bool>&)>
+  CreatePluginsPrefetcher() const;
+  // Has no effect if the prefetch was for another game or if plugins have
+  // been reloaded since it started.
+  void SetPrefetchedPlugins(PrefetchedPlugins&& prefetchedPlugins);
+  // Frees the memory used by any prefetched plugins.
+  void DiscardPrefetchedPlugins();
+  // Returns nullptr if the plugin has not been fully loaded.
+  const PluginInterface* GetFullyLoadedPlugin(const std::string& name) const;
+
+  // Reload the load order and active plugins without reloading plugins.
+  void LoadCurrentLoadOrderState();
+  void LoadBashTagsFiles();
+
+  // Get the directories that plugins may be installed in, in the order that
+  // the game searches them.
+  std::vector<std::filesystem::path> GetPluginsDirectoryPaths() const;
+
+  // Get the paths of the files that store the load order and active plugins,
+  // if they are stored separately from the plugins themselves.
+  std::vector<std::filesystem::path> GetLoadOrderFilePaths() const;
+
   std::filesystem::path MasterlistPath() const;
   std::filesystem::path UserlistPath() const;
   std::filesystem::path GroupNodePositionsPath() const;
@@ -116,7 +187,10 @@ public:
 
   bool IsLoadOrderAmbiguous() const;
 
+  // Reads the load order and plugin file states that sorting depends on.
+  SortPreparation PrepareForSorting();
   std::vector<std::string> SortPlugins();
+  std::vector<std::string> SortPlugins(const SortPreparation& preparation);
   void IncrementLoadOrderSortCount();
   void DecrementLoadOrderSortCount();
 
@@ -124,6 +198,11 @@ public:
   void AppendMessage(const SourcedMessage& message);
   void ClearMessages();
 
+  // Strings interned by the same game share storage if they are equal. The
+  // pool is emptied whenever metadata is reloaded.
+  InternedString InternString(std::string_view value) const;
+  InternedString InternOwnedString(const InternedString& value) const;
+
   void LoadMetadata();
   std::vector<std::string> GetKnownBashTags() const;
 
@@ -143,27 +222,77 @@ public:
   void AddUserMetadata(const PluginMetadata& metadata);
   void ClearUserMetadata(const std::string& pluginName);
   void ClearAllUserMetadata();
+
+  // Applies all the transaction's edits while holding the database lock, so
+  // that a background userlist write never sees only some of them. If an edit
+  // fails, the user metadata is restored to its previous state. Schedules a
+  // single userlist write and returns the names of the plugins whose user
+  // metadata was edited.
+  std::vector<std::string> ApplyUserMetadataTransaction(
+      const UserMetadataTransaction& transaction);
+
+  // Schedules the userlist to be written in the background.
   void SaveUserMetadata();
+  // Blocks until any scheduled userlist write has completed.
+  void FlushUserMetadata();
+  // The handler is called from a background thread if a userlist write fails.
+  void SetUserMetadataWriteErrorHandler(UserlistWriter::ErrorHandler handler);
 
 private:
   std::filesystem::path GetLOOTGamePath() const;
-  std::vector<std::string> GetInstalledPluginPaths() const;
+  static std::vector<std::string> GetInstalledPluginPaths(
+      const GameInterface& gameHandle,
+      const GameSettings& settings,
+      bool isMicrosoftStoreInstall);
   void AppendMessages(std::vector<SourcedMessage> messages);
+  // Errors thrown while preparing are handled in the same way as errors thrown
+  // while sorting.
+  std::vector<std::string> SortPlugins(
+      const std::function<SortPreparation()>& prepare);
+  std::filesystem::path SortCachePath() const;
+  uint64_t GetPluginsSortInputsHash(
+      const std::vector<std::string>& loadOrder,
+      const std::vector<std::string>& pluginPaths) const;
+  uint64_t GetSortInputsHash(uint64_t pluginsHash);
+  bool DoesSortDependOnNonPluginFiles(
+      const std::vector<std::string>& loadOrder) const;
+  std::optional<std::vector<std::string>> GetCachedSortResult(
+      uint64_t sortInputsHash) const;
+  void CacheSortResult(uint64_t sortInputsHash,
+                       const std::vector<std::string>& sortedPlugins) const;
   std::filesystem::path ResolveGameFilePath(
       const std::string& pluginName) const;
   bool FileExists(const std::string& file) const;
+  std::vector<Tag> GetBashTagsFileTags(const std::string& pluginName) const;
 
   GameSettings settings_;
   std::unique_ptr<GameInterface> gameHandle_;
+  // Declared after gameHandle_ so that it's destroyed (and so finishes any
+  // pending write) before the database it writes from.
+  std::unique_ptr<UserlistWriter> userlistWriter_;
+  UserlistWriter::ErrorHandler userMetadataWriteErrorHandler_;
   std::vector<SourcedMessage> messages_;
   std::filesystem::path lootDataPath_;
   std::filesystem::path preludePath_;
   unsigned short loadOrderSortCount_{0};
   bool pluginsFullyLoaded_{false};
+  unsigned int pluginsLoadCount_{0};
+  // Only used to check for overlapping records.
+  std::vector<std::unique_ptr<GameInterface>> prefetchedPluginsHandles_;
   bool isMicrosoftStoreInstall_{false};
+  // A hash of the masterlist and prelude that were last loaded, which is used
+  // when hashing sort inputs.
+  uint64_t metadataListsHash_{0};
 
   // Use Filename to benefit from libloot's case-insensitive comparisons.
   std::set<Filename> creationClubPlugins_;
+
+  // Tags read from the BashTags directory when plugins were loaded, keyed by
+  // the basenames of the plugins they apply to.
+  std::map<Filename, std::vector<Tag>> bashTagsFiles_;
+
+  // Held by pointer so that games can still be moved.
+  std::unique_ptr<StringPool> stringPool_{std::make_unique<StringPool>()};
 };
 }
 
@@ -173,10 +302,13 @@ std::string GetLoadOrderAsTextTable(const gui::Game& game,
 std::string GetMetadataAsBBCodeYaml(const gui::Game& game,
                                     const std::string& pluginName);
 
+// Only maps the plugins for which shouldMap returns true, though the active
+// load order indices passed to the mapper still count all active plugins.
 template<typename T>
 std::vector<T> MapFromLoadOrderData(
     const gui::Game& game,
     const std::vector<std::string>& loadOrder,
+    const std::function<bool(const std::string&)>& shouldMap,
     const std::function<
         T(const PluginInterface* const, std::optional<short>, bool)>& mapper) {
   typedef std::tuple<const PluginInterface* const, std::optional<short>, bool>
@@ -204,7 +336,9 @@ std::vector<T> MapFromLoadOrderData(
     const auto activeLoadOrderIndex =
         isActive ? std::optional(numberOfActivePlugins) : std::nullopt;
 
-    data.push_back(std::make_tuple(plugin, activeLoadOrderIndex, isActive));
+    if (shouldMap(pluginName)) {
+      data.push_back(std::make_tuple(plugin, activeLoadOrderIndex, isActive));
+    }
 
     if (isActive) {
       if (isLight) {
@@ -264,6 +398,16 @@ std::vector<T> MapFromLoadOrderData(
 
   return mappedData;
 }
+
+template<typename T>
+std::vector<T> MapFromLoadOrderData(
+    const gui::Game& game,
+    const std::vector<std::string>& loadOrder,
+    const std::function<
+        T(const PluginInterface* const, std::optional<short>, bool)>& mapper) {
+  return MapFromLoadOrderData<T>(
+      game, loadOrder, [](const std::string&) { return true; }, mapper);
+}
 }
 
 #endif
@@ -0,0 +1,186 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/game_files_snapshot.h"
+
+#include <array>
+#include <boost/algorithm/string.hpp>
+#include <optional>
+
+#include "gui/state/game/helpers.h"
+
+namespace {
+using loot::GameFileState;
+
+constexpr std::array<const char*, 3> PLUGIN_EXTENSIONS = {".esp",
+                                                          ".esm",
+                                                          ".esl"};
+
+std::optional<GameFileState> GetFileState(
+    const std::filesystem::directory_entry& entry) {
+  std::error_code errorCode;
+  if (!entry.is_regular_file(errorCode)) {
+    return std::nullopt;
+  }
+
+  GameFileState state;
+  state.size = entry.file_size(errorCode);
+  if (errorCode) {
+    return std::nullopt;
+  }
+
+  state.lastWriteTime = entry.last_write_time(errorCode);
+  if (errorCode) {
+    return std::nullopt;
+  }
+
+  return state;
+}
+
+std::optional<std::string> GetUnghostedPluginFilename(
+    const std::filesystem::path& path) {
+  auto filename = path.filename().u8string();
+  if (boost::iends_with(filename, loot::GHOST_EXTENSION)) {
+    filename = filename.substr(
+        0,
+        filename.length() -
+            std::char_traits<char>::length(loot::GHOST_EXTENSION));
+  }
+
+  for (const auto extension : PLUGIN_EXTENSIONS) {
+    if (boost::iends_with(filename, extension)) {
+      return filename;
+    }
+  }
+
+  return std::nullopt;
+}
+
+template<typename K>
+void AddChangedKeys(const std::map<K, GameFileState>& before,
+                    const std::map<K, GameFileState>& after,
+                    std::set<K>& changedKeys) {
+  for (const auto& [key, state] : before) {
+    const auto it = after.find(key);
+    if (it == after.end() || it->second != state) {
+      changedKeys.insert(key);
+    }
+  }
+
+  for (const auto& [key, state] : after) {
+    if (before.count(key) == 0) {
+      changedKeys.insert(key);
+    }
+  }
+}
+}
+
+namespace loot {
+bool GameFileState::operator==(const GameFileState& other) const {
+  return size == other.size && lastWriteTime == other.lastWriteTime;
+}
+
+bool GameFileState::operator!=(const GameFileState& other) const {
+  return !(*this == other);
+}
+
+bool GameFilesChanges::IsEmpty() const {
+  return plugins.empty() && bashTagsFiles.empty() && !loadOrder;
+}
+
+void GameFilesChanges::Merge(const GameFilesChanges& other) {
+  plugins.insert(other.plugins.begin(), other.plugins.end());
+  bashTagsFiles.insert(other.bashTagsFiles.begin(), other.bashTagsFiles.end());
+  loadOrder = loadOrder || other.loadOrder;
+}
+
+GameFilesSnapshot TakeGameFilesSnapshot(
+    const std::vector<std::filesystem::path>& pluginsDirectoryPaths,
+    const std::vector<std::filesystem::path>& loadOrderFilePaths) {
+  GameFilesSnapshot snapshot;
+
+  for (const auto& directoryPath : pluginsDirectoryPaths) {
+    std::error_code errorCode;
+    std::filesystem::directory_iterator it(directoryPath, errorCode);
+    for (; !errorCode && it != std::filesystem::directory_iterator();
+         it.increment(errorCode)) {
+      const auto filename = GetUnghostedPluginFilename(it->path());
+      if (!filename.has_value()) {
+        continue;
+      }
+
+      const auto state = GetFileState(*it);
+      if (state.has_value()) {
+        // Don't replace a plugin found in an earlier directory.
+        snapshot.plugins.emplace(Filename(filename.value()), state.value());
+      }
+    }
+  }
+
+  if (!pluginsDirectoryPaths.empty()) {
+    const auto bashTagsPath = pluginsDirectoryPaths.back() / "BashTags";
+
+    std::error_code errorCode;
+    std::filesystem::directory_iterator it(bashTagsPath, errorCode);
+    for (; !errorCode && it != std::filesystem::directory_iterator();
+         it.increment(errorCode)) {
+      if (!boost::iequals(it->path().extension().u8string(), ".txt")) {
+        continue;
+      }
+
+      const auto state = GetFileState(*it);
+      if (state.has_value()) {
+        snapshot.bashTagsFiles.emplace(
+            Filename(it->path().stem().u8string()), state.value());
+      }
+    }
+  }
+
+  for (const auto& filePath : loadOrderFilePaths) {
+    const auto state = GetFileState(std::filesystem::directory_entry(filePath));
+    if (state.has_value()) {
+      snapshot.loadOrderFiles.emplace(filePath, state.value());
+    }
+  }
+
+  return snapshot;
+}
+
+GameFilesChanges GetGameFilesChanges(const GameFilesSnapshot& before,
+                                     const GameFilesSnapshot& after) {
+  GameFilesChanges changes;
+
+  AddChangedKeys(before.plugins, after.plugins, changes.plugins);
+  AddChangedKeys(
+      before.bashTagsFiles, after.bashTagsFiles, changes.bashTagsFiles);
+
+  std::set<std::filesystem::path> changedLoadOrderFiles;
+  AddChangedKeys(
+      before.loadOrderFiles, after.loadOrderFiles, changedLoadOrderFiles);
+  changes.loadOrder = !changedLoadOrderFiles.empty();
+
+  return changes;
+}
+}
@@ -0,0 +1,82 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_GAME_FILES_SNAPSHOT
+#define LOOT_GUI_STATE_GAME_GAME_FILES_SNAPSHOT
+
+#include <loot/metadata/file.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace loot {
+struct GameFileState {
+  std::uintmax_t size{0};
+  std::filesystem::file_time_type lastWriteTime;
+
+  bool operator==(const GameFileState& other) const;
+  bool operator!=(const GameFileState& other) const;
+};
+
+// The state of the files that affect a game's plugin data, as recorded by
+// listing and statting them without reading their content.
+struct GameFilesSnapshot {
+  // Keyed by unghosted plugin filename.
+  std::map<Filename, GameFileState> plugins;
+  // Keyed by the basename of the plugins that they apply to.
+  std::map<Filename, GameFileState> bashTagsFiles;
+  // Keyed by path.
+  std::map<std::filesystem::path, GameFileState> loadOrderFiles;
+};
+
+struct GameFilesChanges {
+  // Unghosted filenames of plugins that have been added, removed or
+  // modified.
+  std::set<Filename> plugins;
+  // Basenames of plugins that have had their BashTags files added, removed
+  // or modified.
+  std::set<Filename> bashTagsFiles;
+  bool loadOrder{false};
+
+  bool IsEmpty() const;
+  void Merge(const GameFilesChanges& other);
+};
+
+// pluginsDirectoryPaths should be given in the order that the game searches
+// them, as a plugin in one directory hides any plugin with the same filename
+// in later directories. BashTags files are read from the last directory.
+GameFilesSnapshot TakeGameFilesSnapshot(
+    const std::vector<std::filesystem::path>& pluginsDirectoryPaths,
+    const std::vector<std::filesystem::path>& loadOrderFilePaths);
+
+GameFilesChanges GetGameFilesChanges(const GameFilesSnapshot& before,
+                                     const GameFilesSnapshot& after);
+}
+
+#endif
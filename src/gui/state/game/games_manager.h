@@ -108,6 +108,8 @@ public:
 
         installedGames.push_back(
             gui::Game(gameSettings, lootDataPath, preludePath));
+        installedGames.back().SetUserMetadataWriteErrorHandler(
+            userMetadataWriteErrorHandler_);
       }
     }
     installedGames_ = std::move(installedGames);
@@ -159,6 +161,13 @@ public:
                     newGameFolder);
     }
 
+    // The previous game's prefetched plugins hold a second, fully loaded copy
+    // of its plugins, so don't keep them in memory once it's no longer in use.
+    if (currentGame_ != installedGames_.end() &&
+        currentGame_->GetSettings().FolderName() != newGameFolder) {
+      currentGame_->DiscardPrefetchedPlugins();
+    }
+
     currentGame_ =
         find_if(installedGames_.begin(),
                 installedGames_.end(),
@@ -201,6 +210,27 @@ public:
     return std::nullopt;
   }
 
+  // Blocks until every game's scheduled userlist writes have completed.
+  void FlushUserMetadata() {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    for (auto& game : installedGames_) {
+      game.FlushUserMetadata();
+    }
+  }
+
+  // The handler is called from a background thread if any game's userlist
+  // write fails.
+  void SetUserMetadataWriteErrorHandler(UserlistWriter::ErrorHandler handler) {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    userMetadataWriteErrorHandler_ = std::move(handler);
+
+    for (auto& game : installedGames_) {
+      game.SetUserMetadataWriteErrorHandler(userMetadataWriteErrorHandler_);
+    }
+  }
+
   bool IsGameInstalled(const std::string& gameFolder) const {
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
@@ -228,6 +258,7 @@ private:
 
   std::vector<gui::Game> installedGames_;
   std::vector<gui::Game>::iterator currentGame_{installedGames_.end()};
+  UserlistWriter::ErrorHandler userMetadataWriteErrorHandler_;
 
   // Mutex used to protect access to member variables.
   mutable std::recursive_mutex mutex_;
@@ -29,7 +29,9 @@
 #include <spdlog/fmt/fmt.h>
 
 #include <boost/algorithm/string.hpp>
+#include <array>
 #include <boost/locale.hpp>
+#include <cstdint>
 #include <fstream>
 #include <regex>
 
@@ -50,6 +52,101 @@ constexpr const char* MS_FO4_VAULT_TEC_DATA_PATH =
     "../../../Fallout 4- Vault-Tec Workshop (PC)/Content/Data";
 constexpr const char* MS_FO4_WASTELAND_DATA_PATH =
     "../../../Fallout 4- Wasteland Workshop (PC)/Content/Data";
+
+// Holds a fixed set of ASCII plugin filenames in an open-addressed table, with
+// the hash seed chosen at compile time so that no two names share a slot. A
+// lookup is then one hash and at most one string comparison, with both being
+// ASCII case-insensitive and allocation-free.
+template<size_t N>
+class OfficialPluginSet {
+public:
+  constexpr explicit OfficialPluginSet(
+      const std::array<std::string_view, N>& names) :
+      names_(names) {
+    while (!TryBuildSlots()) {
+      seed_ += 1;
+    }
+  }
+
+  constexpr bool Contains(std::string_view pluginName) const {
+    const auto index = slots_[SlotIndex(pluginName, seed_)];
+
+    return index != EMPTY_SLOT &&
+           EqualsAsciiCaseInsensitive(names_[index], pluginName);
+  }
+
+private:
+  static_assert(N < UINT8_MAX, "Too many names to index with a uint8_t");
+
+  static constexpr uint8_t EMPTY_SLOT = UINT8_MAX;
+  // A sparse table makes a collision-free seed quick to find.
+  static constexpr size_t SLOTS_PER_NAME = 8;
+
+  static constexpr size_t GetTableSize() {
+    size_t size = 1;
+    while (size < N * SLOTS_PER_NAME) {
+      size *= 2;
+    }
+    return size;
+  }
+
+  static constexpr size_t TABLE_SIZE = GetTableSize();
+
+  static constexpr char ToLowerAscii(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+  }
+
+  static constexpr bool EqualsAsciiCaseInsensitive(std::string_view lhs,
+                                                   std::string_view rhs) {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+
+    for (size_t i = 0; i < lhs.size(); i += 1) {
+      if (ToLowerAscii(lhs[i]) != ToLowerAscii(rhs[i])) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // FNV-1a over the ASCII-lowercased characters, starting from a seeded
+  // offset basis.
+  static constexpr size_t SlotIndex(std::string_view text, uint32_t seed) {
+    constexpr uint32_t FNV_OFFSET_BASIS = 2166136261;
+    constexpr uint32_t FNV_PRIME = 16777619;
+    constexpr uint32_t HIGH_BITS_SHIFT = 16;
+
+    uint32_t hash = FNV_OFFSET_BASIS ^ seed;
+    for (const auto c : text) {
+      hash ^= static_cast<uint8_t>(ToLowerAscii(c));
+      hash *= FNV_PRIME;
+    }
+
+    return (hash ^ (hash >> HIGH_BITS_SHIFT)) & (TABLE_SIZE - 1);
+  }
+
+  constexpr bool TryBuildSlots() {
+    for (auto& slot : slots_) {
+      slot = EMPTY_SLOT;
+    }
+
+    for (size_t i = 0; i < N; i += 1) {
+      auto& slot = slots_[SlotIndex(names_[i], seed_)];
+      if (slot != EMPTY_SLOT) {
+        return false;
+      }
+      slot = static_cast<uint8_t>(i);
+    }
+
+    return true;
+  }
+
+  std::array<std::string_view, N> names_{};
+  std::array<uint8_t, TABLE_SIZE> slots_{};
+  uint32_t seed_{0};
+};
 }
 
 namespace loot {
@@ -171,29 +268,49 @@ std::vector<SourcedMessage> CheckForRemovedPlugins(
   return messages;
 }
 
-std::vector<Tag> ReadBashTagsFile(std::istream& in) {
+std::string_view TrimWhitespace(std::string_view text) {
+  static constexpr std::string_view WHITESPACE = " \t\n\v\f\r";
+
+  const auto start = text.find_first_not_of(WHITESPACE);
+  if (start == std::string_view::npos) {
+    return std::string_view();
+  }
+
+  const auto end = text.find_last_not_of(WHITESPACE);
+
+  return text.substr(start, end - start + 1);
+}
+
+std::vector<Tag> ReadBashTagsFile(std::string_view content) {
+  // This is a hand-rolled tokeniser that works on views into the content, so
+  // that the only allocations made are for the tags themselves.
   std::vector<Tag> tags;
-  for (std::string line; std::getline(in, line);) {
+  while (!content.empty()) {
+    const auto lineEnd = content.find('\n');
+    auto line = content.substr(0, lineEnd);
+    content = lineEnd == std::string_view::npos ? std::string_view()
+                                                : content.substr(lineEnd + 1);
+
     if (line.empty() || line[0] == '#') {
       continue;
     }
 
     line = line.substr(0, line.find('#'));
 
-    std::vector<std::string> entries;
-    boost::split(entries, line, boost::is_any_of(","));
-
-    for (auto& entry : entries) {
-      boost::trim(entry);
+    while (!line.empty()) {
+      const auto entryEnd = line.find(',');
+      const auto entry = TrimWhitespace(line.substr(0, entryEnd));
+      line = entryEnd == std::string_view::npos ? std::string_view()
+                                                : line.substr(entryEnd + 1);
 
       if (entry.empty()) {
         continue;
       }
 
       if (entry[0] == '-') {
-        tags.push_back(Tag(entry.substr(1), false));
+        tags.push_back(Tag(std::string(entry.substr(1)), false));
       } else {
-        tags.push_back(Tag(entry));
+        tags.push_back(Tag(std::string(entry)));
       }
     }
   }
@@ -201,6 +318,13 @@ std::vector<Tag> ReadBashTagsFile(std::istream& in) {
   return tags;
 }
 
+std::vector<Tag> ReadBashTagsFile(std::istream& in) {
+  const std::string content((std::istreambuf_iterator<char>(in)),
+                            std::istreambuf_iterator<char>());
+
+  return ReadBashTagsFile(content);
+}
+
 std::vector<Tag> ReadBashTagsFile(const std::filesystem::path& dataPath,
                                   const std::string& pluginName) {
   static constexpr size_t PLUGIN_EXTENSION_LENGTH = 4;
@@ -218,6 +342,54 @@ std::vector<Tag> ReadBashTagsFile(const std::filesystem::path& dataPath,
   return ReadBashTagsFile(in);
 }
 
+std::map<Filename, std::vector<Tag>> ReadBashTagsFiles(
+    const std::filesystem::path& dataPath) {
+  const auto bashTagsPath = dataPath / "BashTags";
+
+  std::map<Filename, std::vector<Tag>> bashTagsFiles;
+
+  // Enumerate the directory once instead of checking for a file per plugin,
+  // as most plugins don't have a BashTags file.
+  std::error_code errorCode;
+  std::filesystem::directory_iterator it(bashTagsPath, errorCode);
+  if (errorCode) {
+    return bashTagsFiles;
+  }
+
+  const auto logger = getLogger();
+
+  for (; it != std::filesystem::directory_iterator(); it.increment(errorCode)) {
+    if (errorCode) {
+      break;
+    }
+
+    const auto& path = it->path();
+    if (!it->is_regular_file(errorCode) ||
+        !boost::iequals(path.extension().u8string(), ".txt")) {
+      continue;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+      if (logger) {
+        logger->warn("Could not open BashTags file at {}", path.u8string());
+      }
+      continue;
+    }
+
+    bashTagsFiles.insert_or_assign(Filename(path.stem().u8string()),
+                                   ReadBashTagsFile(in));
+  }
+
+  if (logger) {
+    logger->debug("Read {} BashTags files from {}",
+                  bashTagsFiles.size(),
+                  bashTagsPath.u8string());
+  }
+
+  return bashTagsFiles;
+}
+
 std::vector<std::string> GetTagConflicts(const std::vector<Tag>& tags1,
                                          const std::vector<Tag>& tags2) {
   std::set<std::string> additions1;
@@ -311,14 +483,14 @@ std::vector<std::filesystem::path> GetExternalDataPaths(
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/morrowind/__init__.py#L125>
-static constexpr std::array<const char*, 3> TES3_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<3> TES3_OFFICIAL_PLUGINS({
     "bloodmoon.esm",
     "morrowind.esm",
-    "tribunal.esm"};
+    "tribunal.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/oblivion/__init__.py#L266>
-static constexpr std::array<const char*, 16> TES4_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<16> TES4_OFFICIAL_PLUGINS({
     "dlcbattlehorncastle.esp",
     "dlcfrostcrag.esp",
     "dlchorsearmor.esp",
@@ -334,11 +506,11 @@ static constexpr std::array<const char*, 16> TES4_OFFICIAL_PLUGINS = {
     "oblivion_1.1.esm",
     "oblivion_gbr si.esm",
     "oblivion_goty non-si.esm",
-    "oblivion_si.esm"};
+    "oblivion_si.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/skyrim/__init__.py#L277>
-static constexpr std::array<const char*, 8> TES5_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<8> TES5_OFFICIAL_PLUGINS({
     "dawnguard.esm",
     "dragonborn.esm",
     "hearthfires.esm",
@@ -346,11 +518,11 @@ static constexpr std::array<const char*, 8> TES5_OFFICIAL_PLUGINS = {
     "highrestexturepack02.esp",
     "highrestexturepack03.esp",
     "skyrim.esm",
-    "update.esm"};
+    "update.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/skyrimse/__init__.py#L104>
-static constexpr std::array<const char*, 79> TES5SE_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<79> TES5SE_OFFICIAL_PLUGINS({
     "skyrim.esm",
     "update.esm",
     "dawnguard.esm",
@@ -429,11 +601,11 @@ static constexpr std::array<const char*, 79> TES5SE_OFFICIAL_PLUGINS = {
     "ccvsvsse001-winter.esl",
     "ccvsvsse002-pets.esl",
     "ccvsvsse003-necroarts.esl",
-    "ccvsvsse004-beafarmer.esl"};
+    "ccvsvsse004-beafarmer.esl"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/skyrimvr/__init__.py#L70>
-static constexpr std::array<const char*, 80> TES5VR_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<79> TES5VR_OFFICIAL_PLUGINS({
     "skyrim.esm",
     "update.esm",
     "dawnguard.esm",
@@ -512,44 +684,44 @@ static constexpr std::array<const char*, 80> TES5VR_OFFICIAL_PLUGINS = {
     "ccvsvsse001-winter.esl",
     "ccvsvsse002-pets.esl",
     "ccvsvsse003-necroarts.esl",
-    "ccvsvsse004-beafarmer.esl"};
+    "ccvsvsse004-beafarmer.esl"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/nehrim/__init__.py#L84>
-static constexpr std::array<const char*, 5> NEHRIM_OFFICIAL_PLUGINS = {
-    "nehrim.esm"};
+static constexpr OfficialPluginSet<1> NEHRIM_OFFICIAL_PLUGINS({
+    "nehrim.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/enderal/__init__.py#L92>
-static constexpr std::array<const char*, 3> ENDERAL_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<3> ENDERAL_OFFICIAL_PLUGINS({
     "enderal - forgotten stories.esm",
     "skyrim.esm",
-    "update.esm"};
+    "update.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/enderalse/__init__.py#L63>
-static constexpr std::array<const char*, 7> ENDERALSE_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<7> ENDERALSE_OFFICIAL_PLUGINS({
     "dawnguard.esm",
     "dragonborn.esm",
     "enderal - forgotten stories.esm",
     "hearthfires.esm",
     "skyrim.esm",
     "skyui_se.esp",
-    "update.esm"};
+    "update.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/fallout3/__init__.py#L277>
-static constexpr std::array<const char*, 6> FO3_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<6> FO3_OFFICIAL_PLUGINS({
     "anchorage.esm",
     "brokensteel.esm",
     "fallout3.esm",
     "pointlookout.esm",
     "thepitt.esm",
-    "zeta.esm"};
+    "zeta.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/falloutnv/__init__.py#L103>
-static constexpr std::array<const char*, 11> FONV_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<11> FONV_OFFICIAL_PLUGINS({
     "caravanpack.esm",
     "classicpack.esm",
     "deadmoney.esm",
@@ -560,22 +732,22 @@ static constexpr std::array<const char*, 11> FONV_OFFICIAL_PLUGINS = {
     "lonesomeroad.esm",
     "mercenarypack.esm",
     "oldworldblues.esm",
-    "tribalpack.esm"};
+    "tribalpack.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/fallout4/__init__.py#L140>
-static constexpr std::array<const char*, 7> FO4_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<7> FO4_OFFICIAL_PLUGINS({
     "dlccoast.esm",
     "dlcnukaworld.esm",
     "dlcrobot.esm",
     "dlcworkshop01.esm",
     "dlcworkshop02.esm",
     "dlcworkshop03.esm",
-    "fallout4.esm"};
+    "fallout4.esm"});
 
 // Taken from
 // <https://github.com/wrye-bash/wrye-bash/blob/ea0a4f36fc57ad904487f2dbd9ec7e8b587bb528/Mopy/bash/game/fallout4vr/__init__.py#L74>
-static constexpr std::array<const char*, 8> FO4VR_OFFICIAL_PLUGINS = {
+static constexpr OfficialPluginSet<8> FO4VR_OFFICIAL_PLUGINS({
     "dlccoast.esm",
     "dlcnukaworld.esm",
     "dlcrobot.esm",
@@ -583,64 +755,36 @@ static constexpr std::array<const char*, 8> FO4VR_OFFICIAL_PLUGINS = {
     "dlcworkshop02.esm",
     "dlcworkshop03.esm",
     "fallout4.esm",
-    "fallout4_vr.esm"};
-
-bool IsOfficialPlugin(const GameId gameId, const std::string& pluginName) {
-  const auto lowercased = boost::locale::to_lower(pluginName);
+    "fallout4_vr.esm"});
 
+bool IsOfficialPlugin(const GameId gameId, std::string_view pluginName) {
   switch (gameId) {
     case GameId::tes3:
-      return std::find(TES3_OFFICIAL_PLUGINS.begin(),
-                       TES3_OFFICIAL_PLUGINS.end(),
-                       lowercased) != TES3_OFFICIAL_PLUGINS.end();
+      return TES3_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::tes4:
-      return std::find(TES4_OFFICIAL_PLUGINS.begin(),
-                       TES4_OFFICIAL_PLUGINS.end(),
-                       lowercased) != TES4_OFFICIAL_PLUGINS.end();
+      return TES4_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::nehrim:
-      return std::find(NEHRIM_OFFICIAL_PLUGINS.begin(),
-                       NEHRIM_OFFICIAL_PLUGINS.end(),
-                       lowercased) != NEHRIM_OFFICIAL_PLUGINS.end();
+      return NEHRIM_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::tes5:
-      return std::find(TES5_OFFICIAL_PLUGINS.begin(),
-                       TES5_OFFICIAL_PLUGINS.end(),
-                       lowercased) != TES5_OFFICIAL_PLUGINS.end();
+      return TES5_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::enderal:
-      return std::find(ENDERAL_OFFICIAL_PLUGINS.begin(),
-                       ENDERAL_OFFICIAL_PLUGINS.end(),
-                       lowercased) != ENDERAL_OFFICIAL_PLUGINS.end();
+      return ENDERAL_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::tes5se:
-      return std::find(TES5SE_OFFICIAL_PLUGINS.begin(),
-                       TES5SE_OFFICIAL_PLUGINS.end(),
-                       lowercased) != TES5SE_OFFICIAL_PLUGINS.end();
+      return TES5SE_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::enderalse:
-      return std::find(ENDERALSE_OFFICIAL_PLUGINS.begin(),
-                       ENDERALSE_OFFICIAL_PLUGINS.end(),
-                       lowercased) != ENDERALSE_OFFICIAL_PLUGINS.end();
+      return ENDERALSE_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::tes5vr:
-      return std::find(TES5VR_OFFICIAL_PLUGINS.begin(),
-                       TES5VR_OFFICIAL_PLUGINS.end(),
-                       lowercased) != TES5VR_OFFICIAL_PLUGINS.end();
+      return TES5VR_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::fo3:
-      return std::find(FO3_OFFICIAL_PLUGINS.begin(),
-                       FO3_OFFICIAL_PLUGINS.end(),
-                       lowercased) != FO3_OFFICIAL_PLUGINS.end();
+      return FO3_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::fonv:
-      return std::find(FONV_OFFICIAL_PLUGINS.begin(),
-                       FONV_OFFICIAL_PLUGINS.end(),
-                       lowercased) != FONV_OFFICIAL_PLUGINS.end();
+      return FONV_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::fo4:
-      return std::find(FO4_OFFICIAL_PLUGINS.begin(),
-                       FO4_OFFICIAL_PLUGINS.end(),
-                       lowercased) != FO4_OFFICIAL_PLUGINS.end();
+      return FO4_OFFICIAL_PLUGINS.Contains(pluginName);
     case GameId::fo4vr:
-      return std::find(FO4VR_OFFICIAL_PLUGINS.begin(),
-                       FO4VR_OFFICIAL_PLUGINS.end(),
-                       lowercased) != FO4VR_OFFICIAL_PLUGINS.end();
+      return FO4VR_OFFICIAL_PLUGINS.Contains(pluginName);
     default:
       throw std::logic_error("Unrecognised game type");
   }
-
-  return false;
 }
 }
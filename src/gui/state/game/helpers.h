@@ -27,12 +27,15 @@
 #define LOOT_GUI_STATE_GAME_HELPERS
 
 #include <loot/enum/game_type.h>
+#include <loot/metadata/file.h>
 #include <loot/metadata/message.h>
 #include <loot/metadata/plugin_cleaning_data.h>
 #include <loot/metadata/tag.h>
 #include <loot/vertex.h>
 
 #include <filesystem>
+#include <map>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -54,11 +57,19 @@ std::vector<SourcedMessage> CheckForRemovedPlugins(
     const std::vector<std::string>& pluginPathsBefore,
     const std::vector<std::string>& pluginNamesAfter);
 
+std::vector<Tag> ReadBashTagsFile(std::string_view content);
+
 std::vector<Tag> ReadBashTagsFile(std::istream& in);
 
 std::vector<Tag> ReadBashTagsFile(const std::filesystem::path& dataPath,
                                   const std::string& pluginName);
 
+// Read all the BashTags files in the given data path's BashTags directory,
+// keyed by their basenames (which match the basenames of the plugins they
+// apply to).
+std::map<Filename, std::vector<Tag>> ReadBashTagsFiles(
+    const std::filesystem::path& dataPath);
+
 // Return a list of tag names that are added by one source but removed by the
 // other.
 std::vector<std::string> GetTagConflicts(const std::vector<Tag>& tags1,
@@ -76,7 +87,7 @@ std::vector<std::filesystem::path> GetExternalDataPaths(
     const bool isMicrosoftStoreInstall,
     const std::filesystem::path& dataPath);
 
-bool IsOfficialPlugin(const GameId gameId, const std::string& pluginName);
+bool IsOfficialPlugin(const GameId gameId, std::string_view pluginName);
 }
 
 #endif
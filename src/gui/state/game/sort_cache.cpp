@@ -0,0 +1,182 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/sort_cache.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+constexpr uint32_t LSRC_MAGIC_NUMBER = 0x4352534C;
+constexpr uint8_t LSRC_FORMAT_VERSION = 1;
+constexpr size_t MAX_CACHED_RESULTS = 4;
+
+struct CachedSortResult {
+  uint64_t inputsHash{0};
+  std::vector<std::string> sortedPlugins;
+};
+
+// Don't care about endianness because the files don't need to be portable.
+template<typename T>
+T read(std::istream& in) {
+  T value{0};
+  in.read(reinterpret_cast<char*>(&value), sizeof value);
+
+  return value;
+}
+
+template<typename T>
+void write(std::ostream& out, T value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+std::vector<CachedSortResult> LoadSortCache(
+    const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return {};
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  if (read<uint32_t>(in) != LSRC_MAGIC_NUMBER) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": wrong magic number");
+  }
+
+  if (read<uint8_t>(in) != LSRC_FORMAT_VERSION) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": unrecognised format version");
+  }
+
+  std::vector<CachedSortResult> results;
+  while (in.good()) {
+    CachedSortResult result;
+    result.inputsHash = read<uint64_t>(in);
+    const auto pluginsCount = read<uint32_t>(in);
+
+    if (!in.good()) {
+      // Handle reaching end of file.
+      break;
+    }
+
+    for (uint32_t i = 0; i < pluginsCount && in.good(); i += 1) {
+      const auto length = read<uint16_t>(in);
+
+      std::string name(length, '\0');
+      in.read(name.data(), length);
+
+      result.sortedPlugins.push_back(name);
+    }
+
+    if (in.fail()) {
+      throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                               ": unexpected end of file");
+    }
+
+    results.push_back(std::move(result));
+  }
+
+  return results;
+}
+
+void SaveSortCache(const std::filesystem::path& filePath,
+                   const std::vector<CachedSortResult>& results) {
+  // Write to a temporary file and then replace the cache with it, so that an
+  // interrupted write can't leave behind a truncated cache.
+  auto tempPath = filePath;
+  tempPath += ".tmp";
+
+  std::ofstream out(
+      tempPath,
+      std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(tempPath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  write(out, LSRC_MAGIC_NUMBER);
+  write(out, LSRC_FORMAT_VERSION);
+
+  for (const auto& result : results) {
+    write(out, result.inputsHash);
+    write(out, static_cast<uint32_t>(result.sortedPlugins.size()));
+
+    for (const auto& name : result.sortedPlugins) {
+      // Plugin filenames are much shorter than this.
+      if (name.size() > UINT16_MAX) {
+        throw std::runtime_error("Cannot write plugin name longer than " +
+                                 std::to_string(UINT16_MAX) + " bytes");
+      }
+
+      write(out, static_cast<uint16_t>(name.size()));
+      out.write(name.data(), name.size());
+    }
+  }
+
+  out.close();
+  if (out.fail()) {
+    throw std::runtime_error("Failed to write " + tempPath.u8string());
+  }
+
+  std::filesystem::rename(tempPath, filePath);
+}
+}
+
+namespace loot {
+std::optional<std::vector<std::string>> GetCachedSortResult(
+    const std::filesystem::path& filePath,
+    uint64_t inputsHash) {
+  for (auto& result : LoadSortCache(filePath)) {
+    if (result.inputsHash == inputsHash) {
+      return std::move(result.sortedPlugins);
+    }
+  }
+
+  return std::nullopt;
+}
+
+void CacheSortResult(const std::filesystem::path& filePath,
+                     uint64_t inputsHash,
+                     const std::vector<std::string>& sortedPlugins) {
+  std::vector<CachedSortResult> results{{inputsHash, sortedPlugins}};
+
+  try {
+    for (auto& result : LoadSortCache(filePath)) {
+      if (result.inputsHash != inputsHash &&
+          results.size() < MAX_CACHED_RESULTS) {
+        results.push_back(std::move(result));
+      }
+    }
+  } catch (const std::exception&) {
+    // The existing cache can't be read, so just overwrite it.
+  }
+
+  SaveSortCache(filePath, results);
+}
+}
@@ -0,0 +1,47 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_SORT_CACHE
+#define LOOT_GUI_STATE_GAME_SORT_CACHE
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace loot {
+// Returns nullopt if no result has been cached for the given hash.
+std::optional<std::vector<std::string>> GetCachedSortResult(
+    const std::filesystem::path& filePath,
+    uint64_t inputsHash);
+
+// Only a few of the most recently cached results are kept.
+void CacheSortResult(const std::filesystem::path& filePath,
+                     uint64_t inputsHash,
+                     const std::vector<std::string>& sortedPlugins);
+}
+
+#endif
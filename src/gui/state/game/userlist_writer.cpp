@@ -0,0 +1,177 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/userlist_writer.h"
+
+#include "gui/state/logging.h"
+
+namespace loot {
+UserlistWriter::UserlistWriter(DatabaseInterface& database,
+                               const std::filesystem::path& userlistPath,
+                               std::chrono::milliseconds coalescingDelay) :
+    database_(database),
+    userlistPath_(userlistPath),
+    coalescingDelay_(coalescingDelay),
+    thread_([this]() { Run(); }) {}
+
+UserlistWriter::~UserlistWriter() {
+  {
+    std::lock_guard<std::mutex> guard(stateMutex_);
+    isStopping_ = true;
+  }
+  stateChanged_.notify_all();
+
+  // The thread performs any pending write before exiting.
+  thread_.join();
+}
+
+std::unique_lock<std::mutex> UserlistWriter::LockDatabase() {
+  return std::unique_lock<std::mutex>(databaseMutex_);
+}
+
+void UserlistWriter::ScheduleWrite() {
+  {
+    std::lock_guard<std::mutex> guard(stateMutex_);
+    isWritePending_ = true;
+    lastRequestTime_ = std::chrono::steady_clock::now();
+  }
+  stateChanged_.notify_all();
+}
+
+void UserlistWriter::Flush() {
+  std::unique_lock<std::mutex> lock(stateMutex_);
+
+  isFlushRequested_ = true;
+  stateChanged_.notify_all();
+
+  stateChanged_.wait(lock,
+                     [this]() { return !isWritePending_ && !isWriting_; });
+
+  isFlushRequested_ = false;
+
+  if (lastError_) {
+    auto error = lastError_;
+    lastError_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void UserlistWriter::SetErrorHandler(ErrorHandler handler) {
+  std::lock_guard<std::mutex> guard(stateMutex_);
+  errorHandler_ = std::move(handler);
+}
+
+void UserlistWriter::Run() {
+  std::unique_lock<std::mutex> lock(stateMutex_);
+
+  while (true) {
+    stateChanged_.wait(lock,
+                       [this]() { return isWritePending_ || isStopping_; });
+
+    if (!isWritePending_) {
+      // Stopping with nothing left to write.
+      return;
+    }
+
+    // Wait until no more writes have been requested for the coalescing delay,
+    // unless the write is needed now.
+    while (!isStopping_ && !isFlushRequested_) {
+      const auto deadline = lastRequestTime_ + coalescingDelay_;
+      if (std::chrono::steady_clock::now() >= deadline) {
+        break;
+      }
+      stateChanged_.wait_until(lock, deadline);
+    }
+
+    isWritePending_ = false;
+    isWriting_ = true;
+
+    lock.unlock();
+
+    std::exception_ptr error;
+    std::string errorMessage;
+    try {
+      Write();
+    } catch (const std::exception& e) {
+      error = std::current_exception();
+      errorMessage = e.what();
+    } catch (...) {
+      error = std::current_exception();
+      errorMessage = "unknown error";
+    }
+
+    lock.lock();
+
+    // Report each failure once: through the error handler if there is one,
+    // otherwise from the next call to Flush(). A successful write supersedes
+    // any earlier failure.
+    const auto handler = error ? errorHandler_ : nullptr;
+    lastError_ = handler ? nullptr : error;
+
+    if (handler) {
+      // Run the handler before the write is marked as finished so that
+      // Flush() doesn't return before the error has been reported, but don't
+      // hold the lock while running it.
+      lock.unlock();
+      handler(errorMessage);
+      lock.lock();
+    }
+
+    isWriting_ = false;
+    stateChanged_.notify_all();
+  }
+}
+
+void UserlistWriter::Write() {
+  auto tempPath = userlistPath_;
+  tempPath += ".tmp";
+
+  const auto logger = getLogger();
+
+  try {
+    {
+      std::lock_guard<std::mutex> guard(databaseMutex_);
+      database_.WriteUserMetadata(tempPath, true);
+    }
+
+    std::filesystem::rename(tempPath, userlistPath_);
+
+    if (logger) {
+      logger->debug("Wrote user metadata to {}", userlistPath_.u8string());
+    }
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to write user metadata to {}: {}",
+                    userlistPath_.u8string(),
+                    e.what());
+    }
+
+    std::error_code errorCode;
+    std::filesystem::remove(tempPath, errorCode);
+
+    throw;
+  }
+}
+}
@@ -0,0 +1,103 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_USERLIST_WRITER
+#define LOOT_GUI_STATE_GAME_USERLIST_WRITER
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "loot/database_interface.h"
+
+namespace loot {
+// Writes a database's user metadata to disk on a background thread. Bursts
+// of write requests are coalesced into a single write, and each write goes to
+// a temporary file that then replaces the userlist so that a crash mid-write
+// can't corrupt it.
+class UserlistWriter {
+public:
+  // Called from the writer's thread with a description of the error when a
+  // write fails. Errors passed to the handler aren't rethrown by Flush(), and
+  // the handler must not call Flush().
+  using ErrorHandler = std::function<void(const std::string&)>;
+
+  static constexpr std::chrono::milliseconds DEFAULT_COALESCING_DELAY{250};
+
+  UserlistWriter(DatabaseInterface& database,
+                 const std::filesystem::path& userlistPath,
+                 std::chrono::milliseconds coalescingDelay =
+                     DEFAULT_COALESCING_DELAY);
+  UserlistWriter(const UserlistWriter&) = delete;
+  UserlistWriter(UserlistWriter&&) = delete;
+  ~UserlistWriter();
+
+  UserlistWriter& operator=(const UserlistWriter&) = delete;
+  UserlistWriter& operator=(UserlistWriter&&) = delete;
+
+  // The returned lock must be held while changing the database's user
+  // metadata, so that it isn't changed while it is being written.
+  std::unique_lock<std::mutex> LockDatabase();
+
+  // Schedule a write, returning immediately.
+  void ScheduleWrite();
+
+  // Block until any scheduled write has completed. Rethrows the exception
+  // thrown by the last write if it failed and there was no error handler to
+  // report it to.
+  void Flush();
+
+  void SetErrorHandler(ErrorHandler handler);
+
+private:
+  void Run();
+  void Write();
+
+  DatabaseInterface& database_;
+  std::filesystem::path userlistPath_;
+  std::chrono::milliseconds coalescingDelay_;
+
+  std::mutex databaseMutex_;
+
+  std::mutex stateMutex_;
+  std::condition_variable stateChanged_;
+  std::chrono::steady_clock::time_point lastRequestTime_;
+  bool isWritePending_{false};
+  bool isWriting_{false};
+  bool isFlushRequested_{false};
+  bool isStopping_{false};
+  std::exception_ptr lastError_;
+  ErrorHandler errorHandler_;
+
+  std::thread thread_;
+};
+}
+
+#endif
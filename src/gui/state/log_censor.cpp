@@ -0,0 +1,181 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/log_censor.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace loot {
+static constexpr uint32_t NO_STATE = UINT32_MAX;
+
+LogCensor::LogCensor(
+    const std::vector<std::pair<std::string, std::string>>& stringsToCensor) {
+  for (const auto& entry : stringsToCensor) {
+    if (!entry.first.empty()) {
+      stringsToCensor_.push_back(entry);
+    }
+  }
+
+  for (const auto& [search, replacement] : stringsToCensor_) {
+    for (const auto c : search) {
+      auto& byteClass = byteClasses_[static_cast<uint8_t>(c)];
+      if (byteClass == 0) {
+        byteClass = static_cast<uint16_t>(byteClassCount_);
+        byteClassCount_ += 1;
+      }
+    }
+  }
+
+  // Build a trie of the censored strings.
+  states_.emplace_back();
+  transitions_.assign(byteClassCount_, NO_STATE);
+
+  for (size_t i = 0; i < stringsToCensor_.size(); i += 1) {
+    uint32_t state = 0;
+    for (const auto c : stringsToCensor_[i].first) {
+      const auto byte = static_cast<uint8_t>(c);
+      if (transition(state, byte) == NO_STATE) {
+        const auto newState = static_cast<uint32_t>(states_.size());
+        states_.emplace_back();
+        transitions_.resize(transitions_.size() + byteClassCount_, NO_STATE);
+        transition(state, byte) = newState;
+      }
+      state = transition(state, byte);
+    }
+
+    if (states_[state].pattern == NO_PATTERN) {
+      states_[state].pattern = static_cast<uint32_t>(i);
+    }
+  }
+
+  // Now fill in the failure transitions breadth-first, so that each state's
+  // failure state is complete before it's needed.
+  std::vector<uint32_t> failureStates(states_.size(), 0);
+  std::queue<uint32_t> queue;
+
+  for (size_t byteClass = 0; byteClass < byteClassCount_; byteClass += 1) {
+    auto& next = transitions_[byteClass];
+    if (next == NO_STATE) {
+      next = 0;
+    } else {
+      queue.push(next);
+    }
+  }
+
+  while (!queue.empty()) {
+    const auto state = queue.front();
+    queue.pop();
+
+    const auto failureState = failureStates[state];
+    states_[state].outputLink = states_[failureState].pattern != NO_PATTERN
+                                    ? failureState
+                                    : states_[failureState].outputLink;
+
+    const auto row = state * byteClassCount_;
+    const auto failureRow = failureState * byteClassCount_;
+    for (size_t byteClass = 0; byteClass < byteClassCount_; byteClass += 1) {
+      auto& next = transitions_[row + byteClass];
+      const auto failureNext = transitions_[failureRow + byteClass];
+      if (next == NO_STATE) {
+        next = failureNext;
+      } else {
+        failureStates[next] = failureNext;
+        queue.push(next);
+      }
+    }
+  }
+}
+
+const std::vector<std::pair<std::string, std::string>>&
+LogCensor::getStringsToCensor() const {
+  return stringsToCensor_;
+}
+
+bool LogCensor::censor(std::string_view text, std::string& output) const {
+  if (stringsToCensor_.empty()) {
+    return false;
+  }
+
+  struct Match {
+    size_t start;
+    size_t length;
+    uint32_t pattern;
+  };
+
+  // Matches are rare, so this usually doesn't allocate.
+  std::vector<Match> matches;
+
+  uint32_t state = 0;
+  for (size_t i = 0; i < text.size(); i += 1) {
+    state = transition(state, static_cast<uint8_t>(text[i]));
+
+    auto matchState = states_[state].pattern != NO_PATTERN
+                          ? state
+                          : states_[state].outputLink;
+    while (matchState != 0) {
+      const auto pattern = states_[matchState].pattern;
+      const auto length = stringsToCensor_[pattern].first.size();
+      matches.push_back(Match{i + 1 - length, length, pattern});
+
+      matchState = states_[matchState].outputLink;
+    }
+  }
+
+  if (matches.empty()) {
+    return false;
+  }
+
+  std::sort(matches.begin(), matches.end(), [](const auto& a, const auto& b) {
+    return a.start < b.start || (a.start == b.start && a.length > b.length);
+  });
+
+  output.clear();
+
+  size_t position = 0;
+  for (const auto& match : matches) {
+    if (match.start < position) {
+      // This overlaps a match that's already been replaced.
+      continue;
+    }
+
+    output.append(text.substr(position, match.start - position));
+    output.append(stringsToCensor_[match.pattern].second);
+    position = match.start + match.length;
+  }
+
+  output.append(text.substr(position));
+
+  return true;
+}
+
+uint32_t& LogCensor::transition(uint32_t state, uint8_t byte) {
+  return transitions_[state * byteClassCount_ + byteClasses_[byte]];
+}
+
+uint32_t LogCensor::transition(uint32_t state, uint8_t byte) const {
+  return transitions_[state * byteClassCount_ + byteClasses_[byte]];
+}
+}
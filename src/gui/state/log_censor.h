@@ -0,0 +1,83 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_LOG_CENSOR
+#define LOOT_GUI_STATE_LOG_CENSOR
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace loot {
+// Replaces a set of strings in text, finding all of them in a single pass
+// using an Aho-Corasick automaton that's built when the censor is
+// constructed. Where matches overlap, the leftmost is replaced, and if more
+// than one match starts at the same position the longest is replaced.
+class LogCensor {
+public:
+  LogCensor() = default;
+  explicit LogCensor(
+      const std::vector<std::pair<std::string, std::string>>& stringsToCensor);
+
+  const std::vector<std::pair<std::string, std::string>>& getStringsToCensor()
+      const;
+
+  // If the text contains any censored strings, write it to output with them
+  // replaced and return true. Otherwise leave output unchanged and return
+  // false.
+  bool censor(std::string_view text, std::string& output) const;
+
+private:
+  static constexpr uint32_t NO_PATTERN = UINT32_MAX;
+
+  struct State {
+    // The index of the censored string that ends at this state, if any.
+    uint32_t pattern{NO_PATTERN};
+    // The nearest state reachable by failure transitions that ends a
+    // censored string.
+    uint32_t outputLink{0};
+  };
+
+  std::vector<std::pair<std::string, std::string>> stringsToCensor_;
+
+  // Bytes that don't appear in any censored string share byte class 0, so
+  // the transition table only needs a column per distinct byte that does.
+  std::array<uint16_t, 256> byteClasses_{};
+  size_t byteClassCount_{1};
+
+  std::vector<State> states_;
+  // Transitions for every state and byte class, with failure transitions
+  // already resolved, indexed by state * byteClassCount_ + byte class.
+  std::vector<uint32_t> transitions_;
+
+  uint32_t& transition(uint32_t state, uint8_t byte);
+  uint32_t transition(uint32_t state, uint8_t byte) const;
+};
+}
+
+#endif
@@ -25,13 +25,17 @@
 
 #include "gui/state/logging.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
-#include <boost/algorithm/string/replace.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <optional>
 
 #include "gui/helpers.h"
+#include "gui/state/log_censor.h"
 
 #ifdef _WIN32
 #ifndef UNICODE
@@ -49,12 +53,40 @@
 namespace loot {
 static const char* LOGGER_NAME = "loot_logger";
 
+// The file logger queues messages for a background thread to write, so that
+// logging doesn't block the threads doing the work being logged. Writes are
+// buffered and flushed in batches: after LOG_FLUSH_MESSAGE_COUNT messages,
+// every LOG_FLUSH_INTERVAL, and immediately after any error is logged.
+static constexpr size_t LOG_FLUSH_MESSAGE_COUNT = 256;
+static constexpr std::chrono::seconds LOG_FLUSH_INTERVAL(1);
+
+// Looking up the logger in spdlog's registry locks a global mutex, so cache
+// it. It's only replaced when the log path is set.
+static std::shared_ptr<spdlog::logger> cachedLogger;
+
 class CensoringFileSink : public spdlog::sinks::sink {
 public:
   explicit CensoringFileSink(
       const spdlog::filename_t& filename,
       const std::vector<std::pair<std::string, std::string>>& stringsToCensor) :
-      sink(filename), stringsToCensor_(stringsToCensor) {}
+      sink(filename),
+      censor_(std::make_shared<const LogCensor>(stringsToCensor)) {}
+
+  void addStringsToCensor(
+      const std::vector<std::pair<std::string, std::string>>& stringsToCensor) {
+    // Messages are logged on another thread, so build a new censor and swap
+    // it in instead of modifying the current one.
+    std::lock_guard<std::mutex> guard(censorUpdateMutex_);
+    const auto currentCensor = std::atomic_load(&censor_);
+
+    auto newStringsToCensor = currentCensor->getStringsToCensor();
+    newStringsToCensor.insert(newStringsToCensor.end(),
+                              stringsToCensor.begin(),
+                              stringsToCensor.end());
+
+    std::atomic_store(
+        &censor_, std::make_shared<const LogCensor>(newStringsToCensor));
+  }
 
 protected:
   void log(const spdlog::details::log_msg& msg) {
@@ -63,26 +95,27 @@ protected:
       return;
     }
 
-    if (!needsCensoring(msg.payload)) {
+    // Reuse the buffer to avoid allocating for every censored message.
+    thread_local std::string censoredPayload;
+
+    const auto censor = std::atomic_load(&censor_);
+    const std::string_view payload(msg.payload.data(), msg.payload.size());
+    if (!censor->censor(payload, censoredPayload)) {
       // Avoid unnecessary copies.
-      sink.log(msg);
+      logToFile(msg);
       return;
     }
 
     spdlog::details::log_msg msgCopy = msg;
+    msgCopy.payload = censoredPayload;
 
-    std::string payload(msg.payload.data(), msg.payload.size());
-
-    for (const auto& [search, replacement] : stringsToCensor_) {
-      boost::replace_all(payload, search, replacement);
-    }
-
-    msgCopy.payload = payload;
-
-    sink.log(msgCopy);
+    logToFile(msgCopy);
   }
 
-  void flush() { sink.flush(); }
+  void flush() {
+    sink.flush();
+    unflushedMessageCount_ = 0;
+  }
 
   void set_pattern(const std::string& pattern) { sink.set_pattern(pattern); }
 
@@ -92,18 +125,17 @@ protected:
 
 private:
   spdlog::sinks::basic_file_sink_mt sink;
-  std::vector<std::pair<std::string, std::string>> stringsToCensor_;
+  std::shared_ptr<const LogCensor> censor_;
+  std::mutex censorUpdateMutex_;
+  size_t unflushedMessageCount_{0};
 
-  bool needsCensoring(const spdlog::string_view_t& payload) {
-    std::string_view view(payload.data(), payload.size());
+  void logToFile(const spdlog::details::log_msg& msg) {
+    sink.log(msg);
 
-    for (const auto& [search, replacement] : stringsToCensor_) {
-      if (view.find(search) != std::string_view::npos) {
-        return true;
-      }
+    unflushedMessageCount_ += 1;
+    if (unflushedMessageCount_ >= LOG_FLUSH_MESSAGE_COUNT) {
+      flush();
     }
-
-    return false;
   }
 };
 
@@ -118,7 +150,12 @@ std::vector<std::pair<std::string, std::string>> getStringsToCensor() {
 }
 
 std::shared_ptr<spdlog::logger> getLogger() {
-  auto logger = spdlog::get(LOGGER_NAME);
+  auto logger = std::atomic_load(&cachedLogger);
+  if (logger) {
+    return logger;
+  }
+
+  logger = spdlog::get(LOGGER_NAME);
 
   if (!logger) {
     spdlog::set_pattern("[%T.%f] [%l]: %v");
@@ -133,6 +170,8 @@ std::shared_ptr<spdlog::logger> getLogger() {
     }
   }
 
+  std::atomic_store(&cachedLogger, logger);
+
   return logger;
 }
 
@@ -140,6 +179,7 @@ void setLogPath(const std::filesystem::path& outputFile) {
   spdlog::set_pattern("[%T.%f] [%l]: %v");
 
   spdlog::drop(LOGGER_NAME);
+  std::atomic_store(&cachedLogger, std::shared_ptr<spdlog::logger>());
 
 #if defined(_WIN32) && defined(SPDLOG_WCHAR_FILENAMES)
   const auto platformFilePath = outputFile.wstring();
@@ -148,13 +188,36 @@ void setLogPath(const std::filesystem::path& outputFile) {
 #endif
   const auto stringsToCensor = getStringsToCensor();
 
-  auto logger = spdlog::synchronous_factory::create<CensoringFileSink>(
+  // The async factory uses spdlog's global thread pool, which has a single
+  // worker thread (so messages stay in order) and blocks when its queue is
+  // full instead of dropping messages.
+  auto logger = spdlog::async_factory::create<CensoringFileSink>(
       LOGGER_NAME, platformFilePath, stringsToCensor);
 
   if (!logger) {
     throw std::runtime_error("Error: Could not initialise logging.");
   }
-  logger->flush_on(spdlog::level::trace);
+
+  logger->flush_on(spdlog::level::err);
+  spdlog::flush_every(LOG_FLUSH_INTERVAL);
+
+  std::atomic_store(&cachedLogger, logger);
+}
+
+void addStringsToCensor(
+    const std::vector<std::pair<std::string, std::string>>& stringsToCensor) {
+  const auto logger = getLogger();
+  if (!logger) {
+    return;
+  }
+
+  for (const auto& sink : logger->sinks()) {
+    const auto censoringSink =
+        std::dynamic_pointer_cast<CensoringFileSink>(sink);
+    if (censoringSink) {
+      censoringSink->addStringsToCensor(stringsToCensor);
+    }
+  }
 }
 
 void enableDebugLogging(bool enable) {
@@ -167,4 +230,19 @@ void enableDebugLogging(bool enable) {
     }
   }
 }
+
+void shutdownLogging() {
+  // Release the cached logger first so that nothing logs through it once its
+  // thread pool has been destroyed.
+  std::atomic_store(&cachedLogger, std::shared_ptr<spdlog::logger>());
+  spdlog::shutdown();
+}
+
+LoggingShutdownGuard::~LoggingShutdownGuard() {
+  try {
+    shutdownLogging();
+  } catch (...) {
+    // Destructors must not throw, and there's nowhere left to log to.
+  }
+}
 }
@@ -39,13 +39,37 @@
 #endif
 
 #include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace loot {
 std::shared_ptr<spdlog::logger> getLogger();
 
 void setLogPath(const std::filesystem::path& outputFile);
 
+// Replace the given strings with their paired replacements whenever they
+// appear in messages written to the log file.
+void addStringsToCensor(
+    const std::vector<std::pair<std::string, std::string>>& stringsToCensor);
+
 void enableDebugLogging(bool enable);
+
+// Flushes any queued log messages and stops the background logging thread.
+void shutdownLogging();
+
+// Shuts down logging when destroyed, so that messages logged by objects
+// destroyed before it are still written.
+class [[maybe_unused]] LoggingShutdownGuard {
+public:
+  LoggingShutdownGuard() = default;
+  LoggingShutdownGuard(const LoggingShutdownGuard&) = delete;
+  LoggingShutdownGuard(LoggingShutdownGuard&&) = delete;
+  ~LoggingShutdownGuard();
+
+  LoggingShutdownGuard& operator=(const LoggingShutdownGuard&) = delete;
+  LoggingShutdownGuard& operator=(LoggingShutdownGuard&&) = delete;
+};
 }
 
 #endif
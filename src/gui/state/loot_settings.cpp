@@ -757,6 +757,9 @@ void LootSettings::load(const std::filesystem::path& file) {
       settings["enableLootUpdateCheck"].value_or(enableLootUpdateCheck_);
   useNoSortingChangesDialog_ = settings["useNoSortingChangesDialog"].value_or(
       useNoSortingChangesDialog_);
+  useIncrementalBackups_ =
+      settings["useIncrementalBackups"].value_or(useIncrementalBackups_);
+  watchGameFiles_ = settings["watchGameFiles"].value_or(watchGameFiles_);
   game_ = settings["game"].value_or(game_);
   language_ = settings["language"].value_or(language_);
   theme_ = settings["theme"].value_or(theme_);
@@ -865,6 +868,8 @@ void LootSettings::save(const std::filesystem::path& file) {
       {"updateMasterlist", updateMasterlistBeforeSort_},
       {"enableLootUpdateCheck", enableLootUpdateCheck_},
       {"useNoSortingChangesDialog", useNoSortingChangesDialog_},
+      {"useIncrementalBackups", useIncrementalBackups_},
+      {"watchGameFiles", watchGameFiles_},
       {"game", game_},
       {"language", language_},
       {"theme", theme_},
@@ -967,6 +972,18 @@ bool LootSettings::isNoSortingChangesDialogEnabled() const {
   return useNoSortingChangesDialog_;
 }
 
+bool LootSettings::isIncrementalBackupEnabled() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return useIncrementalBackups_;
+}
+
+bool LootSettings::isGameFilesWatchingEnabled() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return watchGameFiles_;
+}
+
 std::string LootSettings::getGame() const {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -1090,6 +1107,18 @@ void LootSettings::enableNoSortingChangesDialog(bool enable) {
   useNoSortingChangesDialog_ = enable;
 }
 
+void LootSettings::enableIncrementalBackup(bool enable) {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  useIncrementalBackups_ = enable;
+}
+
+void LootSettings::enableGameFilesWatching(bool enable) {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  watchGameFiles_ = enable;
+}
+
 void LootSettings::storeLastGame(const std::string& lastGame) {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -78,6 +78,8 @@ public:
   bool isMasterlistUpdateBeforeSortEnabled() const;
   bool isLootUpdateCheckEnabled() const;
   bool isNoSortingChangesDialogEnabled() const;
+  bool isIncrementalBackupEnabled() const;
+  bool isGameFilesWatchingEnabled() const;
   std::string getGame() const;
   std::string getLastGame() const;
   std::string getLastVersion() const;
@@ -99,6 +101,8 @@ public:
   void enableMasterlistUpdateBeforeSort(bool enable);
   void enableLootUpdateCheck(bool enable);
   void enableNoSortingChangesDialog(bool enable);
+  void enableIncrementalBackup(bool enable);
+  void enableGameFilesWatching(bool enable);
 
   void storeLastGame(const std::string& lastGame);
   void storeMainWindowPosition(const WindowPosition& position);
@@ -113,6 +117,8 @@ private:
   bool updateMasterlistBeforeSort_{true};
   bool enableLootUpdateCheck_{true};
   bool useNoSortingChangesDialog_{true};
+  bool useIncrementalBackups_{false};
+  bool watchGameFiles_{false};
   std::string game_{"auto"};
   std::string lastGame_{"auto"};
   std::string lastVersion_;
@@ -42,11 +42,16 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
+#include <fstream>
+#include <set>
 
 #include "gui/helpers.h"
+#include "gui/message_templates.h"
 #include "gui/state/game/detection.h"
+#include "gui/state/game/detection_cache.h"
 #include "gui/state/game/detection/heroic.h"
 #include "gui/state/game/detection/registry.h"
+#include "gui/state/game/detection/steam.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
@@ -63,6 +68,40 @@ loot::SourcedMessage CreateInitErrorMessage(const std::string& text) {
   return loot::CreatePlainTextSourcedMessage(
       loot::MessageType::error, loot::MessageSource::init, text);
 }
+
+#ifdef _WIN32
+// Long enough for a disk to spin up, but short enough to not noticeably delay
+// startup.
+constexpr std::chrono::milliseconds XBOX_GAMING_ROOT_PROBE_TIMEOUT(3000);
+
+// The cache holds one UTF-8 path per line.
+std::vector<fs::path> LoadXboxGamingRootPathsCache(const fs::path& filePath) {
+  std::vector<fs::path> paths;
+
+  std::ifstream in(filePath);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty()) {
+      paths.push_back(fs::u8path(line));
+    }
+  }
+
+  return paths;
+}
+
+void SaveXboxGamingRootPathsCache(const fs::path& filePath,
+                                  const std::vector<fs::path>& paths) {
+  std::ofstream out(filePath, std::ios_base::out | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  for (const auto& path : paths) {
+    out << path.u8string() << '\n';
+  }
+}
+#endif
 }
 
 namespace loot {
@@ -103,6 +142,7 @@ LootState::LootState(const std::filesystem::path& lootAppPath,
   // Do some preliminary locale / UTF-8 support setup.
   boost::locale::generator gen;
   std::locale::global(gen("en.UTF-8"));
+  UpdateMessageTemplates();
 
   // Check if the LOOT local app data folder exists, and create it if not.
   createLootDataPath();
@@ -132,6 +172,10 @@ void LootState::init(const std::string& cmdLineGame,
   // Microsoft Store / Xbox app.
   findXboxGamingRootPaths();
 
+  // Game install paths are often under Steam libraries or Xbox gaming roots,
+  // so censor those before detection starts logging install paths.
+  censorGameLibraryPaths();
+
   preferredUILanguages_ = GetPreferredUILanguages();
   if (preferredUILanguages_.empty() && settings_.getLanguage().size() > 1) {
     preferredUILanguages_ = {settings_.getLanguage()};
@@ -243,6 +287,7 @@ void LootState::loadSettings(const std::string& cmdLineGame, bool autoSort) {
     gen.add_messages_path(l10nPath);
     gen.add_messages_domain("loot");
     std::locale::global(gen(settings_.getLanguage() + ".UTF-8"));
+    UpdateMessageTemplates();
   }
 }
 
@@ -270,12 +315,16 @@ void LootState::checkSettingsFile() {
 void LootState::findXboxGamingRootPaths() {
 #ifdef _WIN32
   try {
-    for (const auto& driveRootPath : GetDriveRootPaths()) {
-      const auto xboxGamingRootPath = FindXboxGamingRootPath(driveRootPath);
-      if (xboxGamingRootPath.has_value()) {
-        xboxGamingRootPaths_.push_back(xboxGamingRootPath.value());
-      }
-    }
+    // The cached paths are only used for drives that don't respond in time.
+    const auto cachePath =
+        LootPaths::getLootDataPath() / "xbox_gaming_roots.txt";
+
+    xboxGamingRootPaths_ =
+        FindXboxGamingRootPaths(GetDriveRootPaths(),
+                                XBOX_GAMING_ROOT_PROBE_TIMEOUT,
+                                LoadXboxGamingRootPathsCache(cachePath));
+
+    SaveXboxGamingRootPathsCache(cachePath, xboxGamingRootPaths_);
   } catch (const exception& e) {
     const auto logger = getLogger();
     if (logger) {
@@ -296,6 +345,52 @@ void LootState::findXboxGamingRootPaths() {
 #endif
 }
 
+void LootState::censorGameLibraryPaths() const {
+  // Use the same style of placeholder as the user profile path's.
+  const auto getPlaceholder = [](const std::string& name, size_t index) {
+#ifdef _WIN32
+    return "%" + name + "_" + std::to_string(index) + "%";
+#else
+    return "$" + name + "_" + std::to_string(index);
+#endif
+  };
+
+  try {
+    // Each app manifest is at <library>/steamapps/appmanifest_<id>.acf.
+    std::set<std::string> steamLibraryPaths;
+    for (const auto& steamInstallPath :
+         steam::GetSteamInstallPaths(Registry())) {
+      for (const auto& manifestPath :
+           steam::GetSteamAppManifestPaths(steamInstallPath)) {
+        steamLibraryPaths.insert(
+            manifestPath.parent_path().parent_path().u8string());
+      }
+    }
+
+    std::vector<std::pair<std::string, std::string>> stringsToCensor;
+
+    size_t index = 1;
+    for (const auto& path : steamLibraryPaths) {
+      stringsToCensor.push_back({path, getPlaceholder("STEAM_LIBRARY", index)});
+      index += 1;
+    }
+
+    index = 1;
+    for (const auto& path : xboxGamingRootPaths_) {
+      stringsToCensor.push_back(
+          {path.u8string(), getPlaceholder("XBOX_GAMING_ROOT", index)});
+      index += 1;
+    }
+
+    addStringsToCensor(stringsToCensor);
+  } catch (const exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to censor game library paths: {}", e.what());
+    }
+  }
+}
+
 void LootState::createPreludeDirectory() {
   auto preludeDir = LootPaths::getPreludePath().parent_path();
   if (!fs::exists(preludeDir)) {
@@ -397,12 +492,17 @@ std::vector<GameSettings> LootState::FindInstalledGames(
     const std::vector<GameSettings>& gamesSettings) const {
   const auto heroicConfigPaths = heroic::GetHeroicGamesLauncherConfigPaths();
 
+  // Detection reads a lot of files, so reuse the installs found by a previous
+  // run of LOOT if none of them have changed.
+  const auto gameInstalls =
+      FindGameInstalls(LootPaths::getLootDataPath() / "detection_cache.bin",
+                       Registry(),
+                       heroicConfigPaths,
+                       xboxGamingRootPaths_,
+                       preferredUILanguages_);
+
   auto gamesSettingsToUpdate = gamesSettings;
-  UpdateInstalledGamesSettings(gamesSettingsToUpdate,
-                               Registry(),
-                               heroicConfigPaths,
-                               xboxGamingRootPaths_,
-                               preferredUILanguages_);
+  UpdateInstalledGamesSettings(gamesSettingsToUpdate, gameInstalls);
 
   return gamesSettingsToUpdate;
 }
@@ -53,6 +53,7 @@ private:
   void loadSettings(const std::string& cmdLineGame, bool autoSort);
   void checkSettingsFile();
   void findXboxGamingRootPaths();
+  void censorGameLibraryPaths() const;
   void createPreludeDirectory();
   void overrideGamePath(const std::string& gameFolderName,
                         const std::filesystem::path& gamePath);
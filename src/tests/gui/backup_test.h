@@ -108,6 +108,36 @@ protected:
 
 class CreateBackupTest : public BackupTest {};
 
+class IncrementalBackupTest : public BackupTest {
+protected:
+  static constexpr const char* backupName = "LOOT-backup-19700101T000000";
+  static constexpr const char* emptyBlobHash =
+      "e69de29bb2d1d6434b8b29ae775a36f9bbf4c5ac";
+
+  static void writeFile(const std::filesystem::path& path,
+                        const std::string& content) {
+    std::ofstream out(path, std::ios::binary);
+    out << content;
+  }
+
+  static std::string readFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  }
+
+  static size_t countObjects(const std::filesystem::path& backupsDir) {
+    size_t count = 0;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(
+             backupsDir / "objects")) {
+      if (entry.is_regular_file()) {
+        count += 1;
+      }
+    }
+    return count;
+  }
+};
+
 TEST_F(CompressDirectoryTest, shouldReturnThePathToAZipOfTheInput) {
   createBackup(sourceRoot, destRoot);
 
@@ -172,6 +202,119 @@ TEST_F(CreateBackupTest, shouldSkipEmptyDirectories) {
 
   EXPECT_FALSE(std::filesystem::exists(destRoot / emptyFolder));
 }
+
+TEST_F(IncrementalBackupTest,
+       createIncrementalBackupShouldWriteAManifestMappingPathsToBlobHashes) {
+  const auto manifestPath =
+      createIncrementalBackup(sourceRoot, destRoot, backupName);
+
+  ASSERT_TRUE(manifestPath.has_value());
+  EXPECT_EQ(destRoot / "manifests" / (std::string(backupName) + ".toml"),
+            manifestPath.value());
+
+  const auto manifest = readBackupManifest(manifestPath.value());
+
+  ASSERT_EQ(2, manifest.files.size());
+  EXPECT_EQ(emptyBlobHash, manifest.files.at(rootDirFile));
+  EXPECT_EQ(emptyBlobHash,
+            manifest.files.at(std::string(subFolder) + "/" + subFolderFile));
+}
+
+TEST_F(IncrementalBackupTest,
+       createIncrementalBackupShouldStoreIdenticalContentOnlyOnce) {
+  createIncrementalBackup(sourceRoot, destRoot, backupName);
+
+  EXPECT_EQ(1, countObjects(destRoot));
+  EXPECT_TRUE(std::filesystem::exists(destRoot / "objects" / "e6" /
+                                      "9de29bb2d1d6434b8b29ae775a36f9bbf4c5ac"));
+}
+
+TEST_F(IncrementalBackupTest,
+       createIncrementalBackupShouldOnlyAddObjectsForChangedContent) {
+  createIncrementalBackup(sourceRoot, destRoot, backupName);
+
+  writeFile(sourceRoot / rootDirFile, "changed");
+
+  createIncrementalBackup(sourceRoot, destRoot, "second");
+
+  EXPECT_EQ(2, countObjects(destRoot));
+}
+
+TEST_F(IncrementalBackupTest,
+       createIncrementalBackupShouldReturnNulloptIfThereAreNoFilesToBackUp) {
+  std::filesystem::remove(sourceRoot / rootDirFile);
+  std::filesystem::remove(sourceRoot / subFolder / subFolderFile);
+
+  EXPECT_FALSE(
+      createIncrementalBackup(sourceRoot, destRoot, backupName).has_value());
+}
+
+TEST_F(IncrementalBackupTest, restoreBackupShouldRecreateTheBackedUpFiles) {
+  writeFile(sourceRoot / rootDirFile, "line 1\r\nline 2\r\n");
+
+  const auto manifestPath =
+      createIncrementalBackup(sourceRoot, destRoot, backupName);
+  ASSERT_TRUE(manifestPath.has_value());
+
+  const auto restoreRoot = destRoot / "restored";
+  restoreBackup(manifestPath.value(), restoreRoot);
+
+  EXPECT_EQ("line 1\r\nline 2\r\n", readFile(restoreRoot / rootDirFile));
+  EXPECT_TRUE(
+      std::filesystem::exists(restoreRoot / subFolder / subFolderFile));
+  EXPECT_FALSE(std::filesystem::exists(restoreRoot / debugLog));
+  EXPECT_FALSE(std::filesystem::exists(restoreRoot / backupsFolder));
+}
+
+TEST_F(IncrementalBackupTest,
+       readBackupManifestShouldThrowIfABlobHashIsNotHexDigits) {
+  const auto manifestPath = destRoot / "manifest.toml";
+  writeFile(manifestPath,
+            "[files]\n\"file.txt\" = "
+            "\"../../../../../../../../../../../../abcd\"\n");
+
+  EXPECT_THROW(readBackupManifest(manifestPath), std::runtime_error);
+}
+
+TEST_F(IncrementalBackupTest,
+       createIncrementalBackupShouldNotLeaveATemporaryManifest) {
+  const auto manifestPath =
+      createIncrementalBackup(sourceRoot, destRoot, backupName);
+  ASSERT_TRUE(manifestPath.has_value());
+
+  auto tempPath = manifestPath.value();
+  tempPath += ".tmp";
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+}
+
+TEST_F(IncrementalBackupTest, exportBackupShouldCreateAZipOfTheBackup) {
+  const auto manifestPath =
+      createIncrementalBackup(sourceRoot, destRoot, backupName);
+  ASSERT_TRUE(manifestPath.has_value());
+
+  const auto zipPath = exportBackup(manifestPath.value(), destRoot);
+
+  EXPECT_EQ(destRoot / (std::string(backupName) + ".zip"), zipPath);
+  EXPECT_TRUE(std::filesystem::exists(zipPath));
+  EXPECT_FALSE(std::filesystem::exists(destRoot / backupName));
+}
+
+TEST_F(IncrementalBackupTest,
+       exportBackupShouldNotChangeAnExistingDirectoryWithTheBackupName) {
+  const auto manifestPath =
+      createIncrementalBackup(sourceRoot, destRoot, backupName);
+  ASSERT_TRUE(manifestPath.has_value());
+
+  const auto existingDir = destRoot / backupName;
+  std::filesystem::create_directory(existingDir);
+  std::ofstream out(existingDir / "existing.txt");
+  out << "existing";
+  out.close();
+
+  exportBackup(manifestPath.value(), destRoot);
+
+  EXPECT_TRUE(std::filesystem::exists(existingDir / "existing.txt"));
+}
 }
 }
 
@@ -0,0 +1,127 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_HASHER_TEST
+#define LOOT_TESTS_GUI_HASHER_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "gui/hasher.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot::test {
+class HasherTest : public ::testing::Test {
+protected:
+  HasherTest() : rootPath(getTempPath()) {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath); }
+
+  void writeFile(const std::filesystem::path& path,
+                 const std::string& content) {
+    std::ofstream out(path, std::ios_base::out | std::ios_base::binary);
+    out << content;
+  }
+
+  const std::filesystem::path rootPath;
+};
+
+TEST(Hasher, shouldGiveTheSameHashForTheSameValues) {
+  Hasher hasher1;
+  hasher1.Add("a");
+  hasher1.Add(uint64_t{1});
+
+  Hasher hasher2;
+  hasher2.Add("a");
+  hasher2.Add(uint64_t{1});
+
+  EXPECT_EQ(hasher1.GetHash(), hasher2.GetHash());
+}
+
+TEST(Hasher, shouldGiveDifferentHashesForDifferentValues) {
+  Hasher hasher1;
+  hasher1.Add("a");
+
+  Hasher hasher2;
+  hasher2.Add("b");
+
+  EXPECT_NE(hasher1.GetHash(), hasher2.GetHash());
+}
+
+TEST(Hasher, shouldDistinguishBetweenStringBoundaries) {
+  Hasher hasher1;
+  hasher1.Add("ab");
+  hasher1.Add("c");
+
+  Hasher hasher2;
+  hasher2.Add("a");
+  hasher2.Add("bc");
+
+  EXPECT_NE(hasher1.GetHash(), hasher2.GetHash());
+}
+
+TEST_F(HasherTest, addFileContentShouldHashTheContentOfTheFile) {
+  const auto filePath = rootPath / "file.txt";
+
+  Hasher missingHasher;
+  missingHasher.AddFileContent(filePath);
+
+  writeFile(filePath, "content");
+  Hasher hasher1;
+  hasher1.AddFileContent(filePath);
+
+  writeFile(filePath, "other");
+  Hasher hasher2;
+  hasher2.AddFileContent(filePath);
+
+  EXPECT_NE(missingHasher.GetHash(), hasher1.GetHash());
+  EXPECT_NE(hasher1.GetHash(), hasher2.GetHash());
+}
+
+TEST_F(HasherTest, addFileStateShouldHashTheSizeOfTheFile) {
+  const auto filePath = rootPath / "file.txt";
+
+  Hasher missingHasher;
+  missingHasher.AddFileState(filePath);
+
+  writeFile(filePath, "content");
+  const auto lastWriteTime = std::filesystem::last_write_time(filePath);
+  Hasher hasher1;
+  hasher1.AddFileState(filePath);
+
+  writeFile(filePath, "longer content");
+  std::filesystem::last_write_time(filePath, lastWriteTime);
+  Hasher hasher2;
+  hasher2.AddFileState(filePath);
+
+  EXPECT_NE(missingHasher.GetHash(), hasher1.GetHash());
+  EXPECT_NE(hasher1.GetHash(), hasher2.GetHash());
+}
+}
+
+#endif
@@ -46,6 +46,17 @@ TEST(GetDriveRootPaths, shouldReturnNonEmptyVector) {
   EXPECT_FALSE(GetDriveRootPaths().empty());
 }
 
+#ifndef _WIN32
+TEST(GetDriveRootPaths, shouldSkipPseudoFilesystemsUnlessTheirTypeIsAllowed) {
+  const auto paths = GetDriveRootPaths();
+  EXPECT_EQ(paths.end(), std::find(paths.begin(), paths.end(), "/proc"));
+
+  const auto allowedPaths = GetDriveRootPaths({"proc"});
+  EXPECT_NE(allowedPaths.end(),
+            std::find(allowedPaths.begin(), allowedPaths.end(), "/proc"));
+}
+#endif
+
 TEST_F(FindXboxGamingRootPathTest,
        shouldReturnNulloptIfTheDotGamingRootFileDoesNotExist) {
   EXPECT_FALSE(FindXboxGamingRootPath(dataPath).has_value());
@@ -99,6 +110,28 @@ TEST_F(FindXboxGamingRootPathTest,
   EXPECT_FALSE(FindXboxGamingRootPath(dataPath).has_value());
 }
 
+TEST_F(FindXboxGamingRootPathTest,
+       findXboxGamingRootPathsShouldReturnTheRootsFoundOnTheGivenDrives) {
+  std::ofstream out(dataPath / ".GamingRoot", std::ios::binary);
+  const char* data = "12345678t\0e\0s\0t\0 \0p\0a\0t\0h\0\0\0";
+  out.write(data, 28);
+  out.close();
+
+  const auto gamingRootPaths = FindXboxGamingRootPaths(
+      {dataPath, localPath}, std::chrono::seconds(10), {});
+
+  EXPECT_EQ(std::vector<std::filesystem::path>({dataPath / "test path"}),
+            gamingRootPaths);
+}
+
+TEST_F(FindXboxGamingRootPathTest,
+       findXboxGamingRootPathsShouldNotUsePreviousRootsOnDrivesThatResponded) {
+  const auto gamingRootPaths = FindXboxGamingRootPaths(
+      {dataPath}, std::chrono::seconds(10), {dataPath / "test path"});
+
+  EXPECT_TRUE(gamingRootPaths.empty());
+}
+
 // MSVC interprets source files in the default code page, so
 // for me u8"\xC3\x9C" != u8"\u00DC", which is a lot of fun.
 // To avoid insanity, write non-ASCII characters as \uXXXX escapes.
@@ -0,0 +1,165 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_INTERNED_STRING_TEST
+#define LOOT_TESTS_GUI_INTERNED_STRING_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/interned_string.h"
+
+namespace loot::test {
+TEST(InternedString, defaultConstructorShouldCreateAnEmptyString) {
+  const InternedString string;
+
+  EXPECT_TRUE(string.empty());
+  EXPECT_EQ("", string.str());
+}
+
+TEST(InternedString, stringConstructorShouldCopyTheGivenValue) {
+  const InternedString string(std::string("value"));
+
+  EXPECT_FALSE(string.empty());
+  EXPECT_EQ("value", string.str());
+}
+
+TEST(InternedString, equalityOperatorShouldCompareValues) {
+  const InternedString string1("value");
+  const InternedString string2("value");
+  const InternedString string3("other");
+
+  EXPECT_TRUE(string1 == string2);
+  EXPECT_FALSE(string1 == string3);
+  EXPECT_FALSE(string1 != string2);
+  EXPECT_TRUE(string1 != string3);
+}
+
+TEST(InternedString, equalityOperatorShouldSupportComparingWithStdStrings) {
+  const InternedString string("value");
+
+  EXPECT_TRUE(string == std::string("value"));
+  EXPECT_TRUE(std::string("value") == string);
+  EXPECT_TRUE(string != std::string("other"));
+  EXPECT_TRUE(std::string("other") != string);
+}
+
+TEST(InternedString, equalityOperatorShouldSupportComparingWithCStrings) {
+  const InternedString string("value");
+
+  EXPECT_TRUE(string == "value");
+  EXPECT_TRUE("value" == string);
+  EXPECT_TRUE(string != "other");
+  EXPECT_TRUE("other" != string);
+}
+
+TEST(InternedString, copiesShouldShareTheSameStorage) {
+  const InternedString string1("value");
+  const auto string2 = string1;
+
+  EXPECT_EQ(&string1.str(), &string2.str());
+}
+
+TEST(StringPool, internShouldReturnAStringWithTheGivenValue) {
+  StringPool pool;
+
+  EXPECT_EQ("value", pool.Intern("value").str());
+  EXPECT_EQ(1, pool.Size());
+}
+
+TEST(StringPool, internShouldReuseStorageForEqualValues) {
+  StringPool pool;
+
+  const auto string1 = pool.Intern("value");
+  const auto string2 = pool.Intern(std::string("value"));
+
+  EXPECT_EQ(&string1.str(), &string2.str());
+  EXPECT_EQ(1, pool.Size());
+}
+
+TEST(StringPool, internShouldNotReuseStorageForDifferentValues) {
+  StringPool pool;
+
+  const auto string1 = pool.Intern("value1");
+  const auto string2 = pool.Intern("value2");
+
+  EXPECT_NE(&string1.str(), &string2.str());
+  EXPECT_EQ(2, pool.Size());
+}
+
+TEST(StringPool, internShouldNotAddEmptyStringsToThePool) {
+  StringPool pool;
+
+  EXPECT_TRUE(pool.Intern("").empty());
+  EXPECT_EQ(0, pool.Size());
+}
+
+TEST(StringPool, clearShouldNotInvalidateExistingStrings) {
+  StringPool pool;
+
+  const auto string1 = pool.Intern("value");
+  pool.Clear();
+
+  EXPECT_EQ(0, pool.Size());
+  EXPECT_EQ("value", string1.str());
+
+  const auto string2 = pool.Intern("value");
+  EXPECT_NE(&string1.str(), &string2.str());
+  EXPECT_EQ(string1, string2);
+}
+
+TEST(StringPool, internOwnedShouldStoreTheGivenStringIfItIsNotInThePool) {
+  StringPool pool;
+
+  const InternedString string1("value");
+  const auto string2 = pool.InternOwned(string1);
+  const auto string3 = pool.Intern("value");
+
+  EXPECT_EQ(&string1.str(), &string2.str());
+  EXPECT_EQ(&string1.str(), &string3.str());
+  EXPECT_EQ(1, pool.Size());
+}
+
+TEST(StringPool, internOwnedShouldReuseStorageForEqualValues) {
+  StringPool pool;
+
+  const auto string1 = pool.Intern("value");
+  const auto string2 = pool.InternOwned(InternedString("value"));
+
+  EXPECT_EQ(&string1.str(), &string2.str());
+  EXPECT_EQ(1, pool.Size());
+}
+
+TEST(StringPool, sizeShouldCountStringsInEveryShard) {
+  StringPool pool;
+
+  for (size_t i = 0; i < 100; i += 1) {
+    pool.Intern(std::to_string(i));
+  }
+
+  EXPECT_EQ(100, pool.Size());
+}
+}
+
+#endif
@@ -38,9 +38,15 @@
 #include <boost/locale.hpp>
 
 #include "tests/gui/backup_test.h"
+#include "tests/gui/hasher_test.h"
 #include "tests/gui/helpers_test.h"
+#include "tests/gui/interned_string_test.h"
+#include "tests/gui/message_templates_test.h"
 #include "tests/gui/qt/helpers_test.h"
+#include "tests/gui/qt/network_session_test.h"
+#include "tests/gui/qt/plugin_attribute_table_test.h"
 #include "tests/gui/qt/tasks/tasks_test.h"
+#include "tests/gui/sequence_diff_test.h"
 #include "tests/gui/sourced_message_test.h"
 #include "tests/gui/state/game/detection/common_test.h"
 #include "tests/gui/state/game/detection/detail_test.h"
@@ -50,12 +56,16 @@
 #include "tests/gui/state/game/detection/heroic_test.h"
 #include "tests/gui/state/game/detection/microsoft_store_test.h"
 #include "tests/gui/state/game/detection/steam_test.h"
+#include "tests/gui/state/game/detection_cache_test.h"
 #include "tests/gui/state/game/detection_test.h"
+#include "tests/gui/state/game/game_files_snapshot_test.h"
 #include "tests/gui/state/game/game_settings_test.h"
 #include "tests/gui/state/game/game_test.h"
 #include "tests/gui/state/game/games_manager_test.h"
 #include "tests/gui/state/game/group_node_positions_test.h"
 #include "tests/gui/state/game/helpers_test.h"
+#include "tests/gui/state/game/sort_cache_test.h"
+#include "tests/gui/state/log_censor_test.h"
 #include "tests/gui/state/loot_paths_test.h"
 #include "tests/gui/state/loot_settings_test.h"
 #include "tests/gui/state/unapplied_change_counter_test.h"
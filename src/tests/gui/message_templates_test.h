@@ -0,0 +1,73 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_MESSAGE_TEMPLATES_TEST
+#define LOOT_TESTS_GUI_MESSAGE_TEMPLATES_TEST
+
+#include <gtest/gtest.h>
+
+#include <boost/locale.hpp>
+
+#include "gui/message_templates.h"
+
+namespace loot::test {
+class MessageTemplatesTest : public ::testing::Test {
+protected:
+  MessageTemplatesTest() :
+      templates(boost::locale::generator().generate("en.UTF-8")) {}
+
+  MessageTemplates templates;
+};
+
+TEST_F(MessageTemplatesTest, getShouldReturnTheUntranslatedTextForEnglish) {
+  EXPECT_EQ("Location", templates.Get(MessageTemplateId::location));
+  EXPECT_EQ("{0} found {1}.",
+            templates.Get(MessageTemplateId::cleaningFoundOne));
+}
+
+TEST_F(MessageTemplatesTest, getShouldReturnADifferentTemplateForEachId) {
+  EXPECT_NE(templates.Get(MessageTemplateId::missingFile),
+            templates.Get(MessageTemplateId::inactiveMaster));
+  EXPECT_NE(templates.Get(MessageTemplateId::cleaningFoundTwo),
+            templates.Get(MessageTemplateId::cleaningFoundDirtyEdits));
+}
+
+TEST_F(MessageTemplatesTest, getShouldSelectThePluralFormForTheGivenCount) {
+  EXPECT_EQ("{0} ITM records",
+            templates.Get(PluralMessageTemplateId::itmRecords, 0));
+  EXPECT_EQ("{0} ITM record",
+            templates.Get(PluralMessageTemplateId::itmRecords, 1));
+  EXPECT_EQ("{0} deleted references",
+            templates.Get(PluralMessageTemplateId::deletedReferences, 2));
+}
+
+TEST_F(MessageTemplatesTest,
+       getShouldSelectThePluralFormForCountsThatWereNotTranslatedUpFront) {
+  EXPECT_EQ("{0} deleted navmeshes",
+            templates.Get(PluralMessageTemplateId::deletedNavmeshes, 100000));
+}
+}
+
+#endif
@@ -0,0 +1,240 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_NETWORK_SESSION_TEST
+#define LOOT_TESTS_GUI_QT_NETWORK_SESSION_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "gui/qt/network_session.h"
+
+namespace loot {
+namespace test {
+// A minimal HTTP/1.1 server that keeps connections alive and responds to
+// every request with the same body, or with 304 Not Modified if the request
+// has an If-None-Match header that matches the body's ETag. Responses are
+// delayed so that concurrent requests overlap.
+class LocalHttpServer {
+public:
+  static constexpr const char* BODY = "response body";
+  static constexpr const char* ETAG = "\"etag\"";
+  static constexpr int RESPONSE_DELAY_MS = 100;
+
+  LocalHttpServer() {
+    QObject::connect(&server, &QTcpServer::newConnection, [this]() {
+      while (server.hasPendingConnections()) {
+        const auto socket = server.nextPendingConnection();
+        connectionCount += 1;
+
+        QObject::connect(socket, &QTcpSocket::readyRead, [this, socket]() {
+          onReadyRead(socket);
+        });
+      }
+    });
+
+    server.listen(QHostAddress::LocalHost);
+  }
+
+  QUrl url(const QString& path) const {
+    return QUrl(QString("http://127.0.0.1:%1%2")
+                    .arg(server.serverPort())
+                    .arg(path));
+  }
+
+  size_t connectionCount{0};
+  size_t requestCount{0};
+  size_t notModifiedCount{0};
+  size_t maxRequestsInProgress{0};
+
+private:
+  void onReadyRead(QTcpSocket* socket) {
+    auto& buffer = buffers[socket];
+    buffer += socket->readAll();
+
+    auto headersEnd = buffer.indexOf("\r\n\r\n");
+    while (headersEnd >= 0) {
+      const auto request = buffer.left(headersEnd);
+      buffer.remove(0, headersEnd + 4);
+      requestCount += 1;
+
+      requestsInProgress += 1;
+      maxRequestsInProgress =
+          std::max(maxRequestsInProgress, requestsInProgress);
+
+      QTimer::singleShot(
+          RESPONSE_DELAY_MS,
+          socket,
+          [this, socket, response = getResponse(request)]() {
+            requestsInProgress -= 1;
+            socket->write(response);
+          });
+
+      headersEnd = buffer.indexOf("\r\n\r\n");
+    }
+  }
+
+  QByteArray getResponse(const QByteArray& request) {
+    if (request.startsWith("GET /missing ")) {
+      return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+    }
+
+    if (request.contains(QByteArray("If-None-Match: ") + ETAG)) {
+      notModifiedCount += 1;
+      return QByteArray("HTTP/1.1 304 Not Modified\r\nETag: ") + ETAG +
+             "\r\n\r\n";
+    }
+
+    return QByteArray("HTTP/1.1 200 OK\r\nETag: ") + ETAG +
+           "\r\nContent-Length: " + QByteArray::number(qstrlen(BODY)) +
+           "\r\n\r\n" + BODY;
+  }
+
+  QTcpServer server;
+  std::map<QTcpSocket*, QByteArray> buffers;
+  size_t requestsInProgress{0};
+};
+
+class NetworkSessionTest : public ::testing::Test {
+protected:
+  static constexpr int TIMEOUT_MS = 5000;
+
+  // Waits for all the responses, running the event loop so that the local
+  // server can respond.
+  std::vector<NetworkResponse> get(NetworkSession& networkSession,
+                                   const std::vector<QUrl>& urls) {
+    std::vector<std::optional<NetworkResponse>> responses(urls.size());
+    size_t responseCount = 0;
+
+    QEventLoop loop;
+    for (size_t i = 0; i < urls.size(); i += 1) {
+      networkSession.get(QNetworkRequest(urls.at(i)),
+                         &loop,
+                         [&, i](const NetworkResponse& response) {
+                           responses.at(i) = response;
+                           responseCount += 1;
+                           if (responseCount == urls.size()) {
+                             loop.quit();
+                           }
+                         });
+    }
+
+    QTimer::singleShot(TIMEOUT_MS, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    std::vector<NetworkResponse> results;
+    for (const auto& response : responses) {
+      EXPECT_TRUE(response.has_value());
+      results.push_back(response.value_or(NetworkResponse()));
+    }
+
+    return results;
+  }
+
+  LocalHttpServer server;
+  NetworkSession session;
+};
+
+TEST_F(NetworkSessionTest, getShouldGiveTheResponseBody) {
+  const auto responses = get(session, {server.url("/file")});
+
+  EXPECT_FALSE(responses.at(0).error.has_value());
+  EXPECT_EQ(QByteArray(LocalHttpServer::BODY), responses.at(0).data);
+}
+
+TEST_F(NetworkSessionTest, getShouldGiveAnErrorIfTheRequestFails) {
+  const auto responses = get(session, {server.url("/missing")});
+
+  EXPECT_TRUE(responses.at(0).error.has_value());
+  EXPECT_FALSE(responses.at(0).data.has_value());
+}
+
+TEST_F(NetworkSessionTest, getShouldReuseConnectionsForLaterRequests) {
+  get(session, {server.url("/file")});
+  get(session, {server.url("/other")});
+
+  EXPECT_EQ(2, server.requestCount);
+  EXPECT_EQ(1, server.connectionCount);
+}
+
+TEST_F(NetworkSessionTest,
+       getShouldGiveTheCachedBodyIfTheServerRespondsWithNotModified) {
+  get(session, {server.url("/file")});
+  const auto responses = get(session, {server.url("/file")});
+
+  EXPECT_EQ(1, server.notModifiedCount);
+  EXPECT_FALSE(responses.at(0).error.has_value());
+  EXPECT_EQ(QByteArray(LocalHttpServer::BODY), responses.at(0).data);
+}
+
+TEST_F(NetworkSessionTest,
+       getShouldNotSendMoreThanTheMaximumNumberOfRequestsAtOnce) {
+  NetworkSession limitedSession(nullptr, 2);
+
+  const auto responses = get(limitedSession,
+                             {server.url("/file1"),
+                              server.url("/file2"),
+                              server.url("/file3"),
+                              server.url("/file4")});
+
+  for (const auto& response : responses) {
+    EXPECT_EQ(QByteArray(LocalHttpServer::BODY), response.data);
+  }
+
+  EXPECT_EQ(4, server.requestCount);
+  EXPECT_EQ(2, server.maxRequestsInProgress);
+}
+
+TEST_F(NetworkSessionTest,
+       getShouldNotRunTheCallbackIfTheContextObjectHasBeenDestroyed) {
+  auto context = new QObject();
+  bool wasCallbackRun = false;
+
+  session.get(QNetworkRequest(server.url("/file")),
+              context,
+              [&](const NetworkResponse&) { wasCallbackRun = true; });
+  delete context;
+
+  // Wait for the response to be received.
+  QEventLoop loop;
+  QTimer::singleShot(
+      LocalHttpServer::RESPONSE_DELAY_MS * 3, &loop, &QEventLoop::quit);
+  loop.exec();
+
+  EXPECT_EQ(1, server.requestCount);
+  EXPECT_FALSE(wasCallbackRun);
+}
+}
+}
+
+#endif
@@ -0,0 +1,222 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_ATTRIBUTE_TABLE_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_ATTRIBUTE_TABLE_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/plugin_attribute_table.h"
+
+namespace loot {
+namespace test {
+TEST(PluginBitset, constructorShouldSetAllBitsToTheGivenValue) {
+  const PluginBitset set(70, true);
+  const PluginBitset unset(70, false);
+
+  EXPECT_EQ(70, set.size());
+  EXPECT_EQ(70, unset.size());
+  for (size_t i = 0; i < 70; i += 1) {
+    EXPECT_TRUE(set.test(i));
+    EXPECT_FALSE(unset.test(i));
+  }
+}
+
+TEST(PluginBitset, setShouldOnlyChangeTheGivenBit) {
+  PluginBitset bitset(70, false);
+
+  bitset.set(65, true);
+
+  EXPECT_FALSE(bitset.test(64));
+  EXPECT_TRUE(bitset.test(65));
+  EXPECT_FALSE(bitset.test(66));
+
+  bitset.set(65, false);
+
+  EXPECT_FALSE(bitset.test(65));
+}
+
+TEST(PluginBitset, andAssignShouldKeepOnlyBitsSetInBothBitsets) {
+  PluginBitset lhs(3, false);
+  lhs.set(0, true);
+  lhs.set(1, true);
+  PluginBitset rhs(3, false);
+  rhs.set(1, true);
+  rhs.set(2, true);
+
+  lhs &= rhs;
+
+  EXPECT_FALSE(lhs.test(0));
+  EXPECT_TRUE(lhs.test(1));
+  EXPECT_FALSE(lhs.test(2));
+}
+
+TEST(PluginBitset, subtractShouldClearBitsSetInTheOtherBitset) {
+  PluginBitset lhs(3, true);
+  PluginBitset rhs(3, false);
+  rhs.set(1, true);
+
+  lhs.subtract(rhs);
+
+  EXPECT_TRUE(lhs.test(0));
+  EXPECT_FALSE(lhs.test(1));
+  EXPECT_TRUE(lhs.test(2));
+}
+
+class PluginAttributeTableTest : public ::testing::Test {
+protected:
+  PluginAttributeTableTest() {
+    PluginItem active;
+    active.name = "active.esp";
+    active.isActive = true;
+    active.group = InternedString("group1");
+    active.messages.push_back(CreatePlainTextSourcedMessage(
+        MessageType::say, MessageSource::messageMetadata, "note"));
+
+    PluginItem creationClub;
+    creationClub.name = "ccplugin.esl";
+    creationClub.isCreationClubPlugin = true;
+    creationClub.isEmpty = true;
+
+    PluginItem inactive;
+    inactive.name = "inactive.esp";
+    inactive.group = InternedString("group1");
+    inactive.messages.push_back(CreatePlainTextSourcedMessage(
+        MessageType::warn, MessageSource::messageMetadata, "warning"));
+
+    items = {active, creationClub, inactive};
+    table.assign(items, contentFilters);
+  }
+
+  std::vector<bool> getAcceptedPlugins(const PluginFiltersState& filters) {
+    const auto bitset = table.getAcceptedPlugins(filters);
+
+    std::vector<bool> accepted;
+    for (size_t i = 0; i < bitset.size(); i += 1) {
+      accepted.push_back(bitset.test(i));
+      EXPECT_EQ(accepted.back(), table.isAccepted(i, filters));
+    }
+
+    return accepted;
+  }
+
+  std::vector<PluginItem> items;
+  CardContentFiltersState contentFilters;
+  PluginAttributeTable table;
+};
+
+TEST_F(PluginAttributeTableTest, noFiltersShouldAcceptAllPlugins) {
+  EXPECT_EQ(std::vector<bool>({true, true, true}),
+            getAcceptedPlugins(PluginFiltersState()));
+}
+
+TEST_F(PluginAttributeTableTest,
+       hideInactivePluginsShouldRejectInactivePlugins) {
+  PluginFiltersState filters;
+  filters.hideInactivePlugins = true;
+
+  EXPECT_EQ(std::vector<bool>({true, false, false}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest,
+       hideMessagelessPluginsShouldUseTheCardContentFilters) {
+  PluginFiltersState filters;
+  filters.hideMessagelessPlugins = true;
+
+  EXPECT_EQ(std::vector<bool>({true, false, true}),
+            getAcceptedPlugins(filters));
+
+  contentFilters.hideNotes = true;
+  table.assign(items, contentFilters);
+
+  EXPECT_EQ(std::vector<bool>({false, false, true}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest,
+       hideCreationClubPluginsShouldRejectCreationClubPlugins) {
+  PluginFiltersState filters;
+  filters.hideCreationClubPlugins = true;
+
+  EXPECT_EQ(std::vector<bool>({true, false, true}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest, showOnlyEmptyPluginsShouldRejectOtherPlugins) {
+  PluginFiltersState filters;
+  filters.showOnlyEmptyPlugins = true;
+
+  EXPECT_EQ(std::vector<bool>({false, true, false}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest, groupNameShouldRejectPluginsInOtherGroups) {
+  PluginFiltersState filters;
+  filters.groupName = "group1";
+
+  EXPECT_EQ(std::vector<bool>({true, false, true}),
+            getAcceptedPlugins(filters));
+
+  filters.groupName = Group::DEFAULT_NAME;
+
+  EXPECT_EQ(std::vector<bool>({false, true, false}),
+            getAcceptedPlugins(filters));
+
+  filters.groupName = "unknown";
+
+  EXPECT_EQ(std::vector<bool>({false, false, false}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest, filtersShouldBeCombined) {
+  PluginFiltersState filters;
+  filters.hideInactivePlugins = true;
+  filters.groupName = "group1";
+
+  EXPECT_EQ(std::vector<bool>({true, false, false}),
+            getAcceptedPlugins(filters));
+}
+
+TEST_F(PluginAttributeTableTest, updateShouldChangeOnlyTheGivenPlugin) {
+  items[2].isActive = true;
+  items[2].group = InternedString("group2");
+  table.update(2, items[2], contentFilters);
+
+  PluginFiltersState filters;
+  filters.hideInactivePlugins = true;
+
+  EXPECT_EQ(std::vector<bool>({true, false, true}),
+            getAcceptedPlugins(filters));
+
+  filters.groupName = "group2";
+
+  EXPECT_EQ(std::vector<bool>({false, false, true}),
+            getAcceptedPlugins(filters));
+}
+}
+}
+
+#endif
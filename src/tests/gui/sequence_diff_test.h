@@ -0,0 +1,97 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_SEQUENCE_DIFF_TEST
+#define LOOT_TESTS_GUI_SEQUENCE_DIFF_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/sequence_diff.h"
+
+namespace loot::test {
+TEST(DiffSequences, shouldReturnAnEmptyDiffIfTheSequencesAreEqual) {
+  const auto diff = DiffSequences({"a", "b", "c"}, {"a", "b", "c"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_TRUE(diff->removed.empty());
+  EXPECT_TRUE(diff->moved.empty());
+  EXPECT_TRUE(diff->inserted.empty());
+}
+
+TEST(DiffSequences, shouldReturnNulloptIfTheOldSequenceHasDuplicates) {
+  EXPECT_FALSE(DiffSequences({"a", "a"}, {"a"}).has_value());
+}
+
+TEST(DiffSequences, shouldReturnNulloptIfTheNewSequenceHasDuplicates) {
+  EXPECT_FALSE(DiffSequences({"a"}, {"a", "a"}).has_value());
+}
+
+TEST(DiffSequences, shouldListOldIndicesOfElementsNotInTheNewSequence) {
+  const auto diff = DiffSequences({"a", "b", "c", "d"}, {"b", "d"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_EQ(std::vector<size_t>({0, 2}), diff->removed);
+  EXPECT_TRUE(diff->moved.empty());
+  EXPECT_TRUE(diff->inserted.empty());
+}
+
+TEST(DiffSequences, shouldListNewIndicesOfElementsNotInTheOldSequence) {
+  const auto diff = DiffSequences({"b", "d"}, {"a", "b", "c", "d"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_TRUE(diff->removed.empty());
+  EXPECT_TRUE(diff->moved.empty());
+  EXPECT_EQ(std::vector<size_t>({0, 2}), diff->inserted);
+}
+
+TEST(DiffSequences, shouldOnlyMoveTheElementThatChangedPosition) {
+  const auto diff =
+      DiffSequences({"a", "b", "c", "d", "e"}, {"b", "c", "d", "e", "a"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_TRUE(diff->removed.empty());
+  EXPECT_EQ(std::vector<size_t>({4}), diff->moved);
+  EXPECT_TRUE(diff->inserted.empty());
+}
+
+TEST(DiffSequences, shouldMoveAllButOneElementIfTheOrderIsReversed) {
+  const auto diff = DiffSequences({"a", "b", "c", "d"}, {"d", "c", "b", "a"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_EQ(3, diff->moved.size());
+}
+
+TEST(DiffSequences, shouldHandleRemovalsMovesAndInsertionsTogether) {
+  const auto diff =
+      DiffSequences({"a", "b", "c", "d", "e"}, {"b", "f", "d", "c", "e"});
+
+  ASSERT_TRUE(diff.has_value());
+  EXPECT_EQ(std::vector<size_t>({0}), diff->removed);
+  EXPECT_EQ(1, diff->moved.size());
+  EXPECT_EQ(std::vector<size_t>({1}), diff->inserted);
+}
+}
+
+#endif
@@ -124,6 +124,25 @@ TEST_P(Epic_FindGameInstallsTest,
   EXPECT_FALSE(install.has_value());
 }
 
+TEST_P(Epic_FindGameInstallsTest,
+       shouldFindAnEpicInstallWhoseManifestWasAddedAfterAPreviousCheck) {
+  const auto manifestPath = epicManifestsPath / "manifest.item";
+  const auto movedManifestPath = epicManifestsPath.parent_path() / "moved";
+  std::filesystem::rename(manifestPath, movedManifestPath);
+
+  EXPECT_FALSE(epic::FindGameInstalls(registry, GetParam(), {}).has_value());
+
+  std::filesystem::rename(movedManifestPath, manifestPath);
+  // Make sure the change is visible even if the filesystem's timestamps are
+  // coarse.
+  std::filesystem::last_write_time(
+      epicManifestsPath,
+      std::filesystem::last_write_time(epicManifestsPath) +
+          std::chrono::hours(1));
+
+  EXPECT_TRUE(epic::FindGameInstalls(registry, GetParam(), {}).has_value());
+}
+
 TEST_P(Epic_FindGameInstallsTest,
        shouldPickLocalisedInstallPathAccordingToPreferredUILanguageOrder) {
   const auto install =
@@ -70,24 +70,34 @@ protected:
 
   void TearDown() override { std::filesystem::remove_all(rootPath_); }
 
+  void WriteInstalledFallout3Json() const {
+    std::ofstream out(gogInstalledPath_);
+    out << R"test({"installed": [{
+	"install_path": "/home/user/Games/Heroic/Fallout 3",
+	"appName": "1454315831"
+}]})test";
+  }
+
   const std::filesystem::path rootPath_;
   const std::filesystem::path gogInstalledPath_;
   const std::filesystem::path egsInstalledPath_;
   const std::filesystem::path gamesConfigPath_;
 };
 
-class Heroic_GetInstalledGogGamesTest : public HeroicTest {};
+class Heroic_HeroicSnapshotTest : public HeroicTest {};
 
-TEST_F(Heroic_GetInstalledGogGamesTest,
-       shouldReturnNoInstallsIfTheInstalledJsonFileDoesNotExist) {
-  const auto installs = loot::heroic::GetInstalledGogGames(rootPath_);
+TEST_F(
+    Heroic_HeroicSnapshotTest,
+    getInstalledGogGamesShouldReturnNoInstallsIfTheInstalledJsonFileDoesNotExist) {
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledGogGames();
 
   EXPECT_TRUE(installs.empty());
 }
 
 TEST_F(
-    Heroic_GetInstalledGogGamesTest,
-    shouldReturnNoInstallsIfThereIsAnInstalledJsonFileButItHasNoSupportedGames) {
+    Heroic_HeroicSnapshotTest,
+    getInstalledGogGamesShouldReturnNoInstallsIfThereIsAnInstalledJsonFileButItHasNoSupportedGames) {
   std::ofstream out(gogInstalledPath_);
   out << R"test({"installed": [{
 	"install_path": "/home/user/Games/Heroic/Oblivion",
@@ -95,12 +105,14 @@ TEST_F(
 }]})test";
   out.close();
 
-  const auto installs = loot::heroic::GetInstalledGogGames(rootPath_);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledGogGames();
 
   EXPECT_TRUE(installs.empty());
 }
 
-TEST_F(Heroic_GetInstalledGogGamesTest, shouldReturnAllSupportedGameInstalls) {
+TEST_F(Heroic_HeroicSnapshotTest,
+       getInstalledGogGamesShouldReturnAllSupportedGameInstalls) {
   std::ofstream out(gogInstalledPath_);
   out << R"test({"installed": [
   {
@@ -118,7 +130,8 @@ TEST_F(Heroic_GetInstalledGogGamesTest, shouldReturnAllSupportedGameInstalls) {
 ]})test";
   out.close();
 
-  const auto installs = loot::heroic::GetInstalledGogGames(rootPath_);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledGogGames();
 
   ASSERT_EQ(2, installs.size());
   EXPECT_EQ(GameId::tes3, installs[0].gameId);
@@ -131,18 +144,18 @@ TEST_F(Heroic_GetInstalledGogGamesTest, shouldReturnAllSupportedGameInstalls) {
             installs[1].installPath);
 }
 
-class Heroic_GetInstalledEgsGamesTest : public HeroicTest {};
-
-TEST_F(Heroic_GetInstalledEgsGamesTest,
-       shouldReturnNoInstallsIfTheInstalledJsonFileDoesNotExist) {
-  const auto installs = loot::heroic::GetInstalledEgsGames(rootPath_);
+TEST_F(
+    Heroic_HeroicSnapshotTest,
+    getInstalledEgsGamesShouldReturnNoInstallsIfTheInstalledJsonFileDoesNotExist) {
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledEgsGames();
 
   EXPECT_TRUE(installs.empty());
 }
 
 TEST_F(
-    Heroic_GetInstalledEgsGamesTest,
-    shouldReturnNoInstallsIfThereIsAnInstalledJsonFileButItHasNoSupportedGames) {
+    Heroic_HeroicSnapshotTest,
+    getInstalledEgsGamesShouldReturnNoInstallsIfThereIsAnInstalledJsonFileButItHasNoSupportedGames) {
   std::ofstream out(egsInstalledPath_);
   out << R"test({"installed": [{
 	"install_path": "/home/user/Games/Heroic/Oblivion",
@@ -150,12 +163,14 @@ TEST_F(
 }]})test";
   out.close();
 
-  const auto installs = loot::heroic::GetInstalledEgsGames(rootPath_);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledEgsGames();
 
   EXPECT_TRUE(installs.empty());
 }
 
-TEST_F(Heroic_GetInstalledEgsGamesTest, shouldReturnAllSupportedGameInstalls) {
+TEST_F(Heroic_HeroicSnapshotTest,
+       getInstalledEgsGamesShouldReturnAllSupportedGameInstalls) {
   std::ofstream out(egsInstalledPath_);
   out << R"test({
   "unsupported": {
@@ -173,7 +188,8 @@ TEST_F(Heroic_GetInstalledEgsGamesTest, shouldReturnAllSupportedGameInstalls) {
 })test";
   out.close();
 
-  const auto installs = loot::heroic::GetInstalledEgsGames(rootPath_);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+  const auto& installs = snapshot.GetInstalledEgsGames();
 
   ASSERT_EQ(2, installs.size());
   EXPECT_EQ(GameId::tes5se, installs[0].gameId);
@@ -187,48 +203,105 @@ TEST_F(Heroic_GetInstalledEgsGamesTest, shouldReturnAllSupportedGameInstalls) {
             installs[1].installPath);
 }
 
-class Heroic_GetGameLocalPathTest : public HeroicTest {};
+TEST_F(Heroic_HeroicSnapshotTest, getShouldReuseASnapshotIfNoFilesHaveChanged) {
+  std::ofstream out(gogInstalledPath_);
+  out << R"test({"installed": [{
+	"install_path": "/home/user/Games/Heroic/Fallout 3",
+	"appName": "1454315831"
+}]})test";
+  out.close();
+
+  const auto snapshot = loot::heroic::HeroicSnapshot::Get(rootPath_);
+
+  EXPECT_EQ(snapshot, loot::heroic::HeroicSnapshot::Get(rootPath_));
+}
+
+TEST_F(Heroic_HeroicSnapshotTest, getShouldRereadFilesThatHaveChanged) {
+  std::ofstream out(gogInstalledPath_);
+  out << R"test({"installed": []})test";
+  out.close();
+
+  const auto snapshot = loot::heroic::HeroicSnapshot::Get(rootPath_);
+  EXPECT_TRUE(snapshot->GetInstalledGogGames().empty());
+
+  out.open(gogInstalledPath_);
+  out << R"test({"installed": [{
+	"install_path": "/home/user/Games/Heroic/Fallout 3",
+	"appName": "1454315831"
+}]})test";
+  out.close();
+
+  const auto newSnapshot = loot::heroic::HeroicSnapshot::Get(rootPath_);
+  ASSERT_EQ(1, newSnapshot->GetInstalledGogGames().size());
+  EXPECT_EQ("1454315831", newSnapshot->GetInstalledGogGames()[0].appName);
+}
+
+#ifndef _WIN32
+TEST_F(Heroic_HeroicSnapshotTest,
+       getGameLocalPathShouldThrowIfTheGameConfigPathDoesNotExist) {
+  WriteInstalledFallout3Json();
+
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
 
-TEST_F(Heroic_GetGameLocalPathTest,
-       shouldThrowIfTheGameConfigPathDoesNotExist) {
-  EXPECT_THROW(
-      loot::heroic::GetGameLocalPath(rootPath_, "1454315831", "Fallout3"),
-      std::runtime_error);
+  EXPECT_THROW(snapshot.GetGameLocalPath("1454315831", "Fallout3"),
+               std::runtime_error);
 }
 
-TEST_F(Heroic_GetGameLocalPathTest, shouldThrowIfTheExpectedAppNameIsNotFound) {
+TEST_F(Heroic_HeroicSnapshotTest,
+       getGameLocalPathShouldThrowIfTheExpectedAppNameIsNotFound) {
+  WriteInstalledFallout3Json();
+
   std::ofstream out(gamesConfigPath_ / "1454315831.json");
   out << R"test({"1435828767": {
 "winePrefix": "/home/user/Games/Heroic/default"
 }})test";
   out.close();
 
-  EXPECT_THROW(
-      loot::heroic::GetGameLocalPath(rootPath_, "1454315831", "Fallout3"),
-      std::runtime_error);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+
+  EXPECT_THROW(snapshot.GetGameLocalPath("1454315831", "Fallout3"),
+               std::runtime_error);
 }
 
-TEST_F(Heroic_GetGameLocalPathTest, shouldThrowIfThereIsNoWinePrefix) {
+TEST_F(Heroic_HeroicSnapshotTest,
+       getGameLocalPathShouldThrowIfThereIsNoWinePrefix) {
+  WriteInstalledFallout3Json();
+
   std::ofstream out(gamesConfigPath_ / "1454315831.json");
   out << R"test({"1454315831": {}})test";
   out.close();
 
-  EXPECT_THROW(
-      loot::heroic::GetGameLocalPath(rootPath_, "1454315831", "Fallout3"),
-      std::runtime_error);
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+
+  EXPECT_THROW(snapshot.GetGameLocalPath("1454315831", "Fallout3"),
+               std::runtime_error);
+}
+
+TEST_F(Heroic_HeroicSnapshotTest,
+       getGameLocalPathShouldThrowIfTheGameIsNotInstalled) {
+  WriteInstalledFallout3Json();
+
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+
+  EXPECT_THROW(snapshot.GetGameLocalPath("1435828767", "Morrowind"),
+               std::runtime_error);
 }
 
-TEST_F(Heroic_GetGameLocalPathTest,
-       shouldReturnTheLocalPathConstructedFromTheWinePrefixAndGivenGameFolder) {
+TEST_F(
+    Heroic_HeroicSnapshotTest,
+    getGameLocalPathShouldReturnTheLocalPathConstructedFromTheWinePrefixAndGivenGameFolder) {
+  WriteInstalledFallout3Json();
+
   std::ofstream out(gamesConfigPath_ / "1454315831.json");
   out << R"test({"1454315831": {
 "winePrefix": "/home/user/Games/Heroic/default"
 }})test";
   out.close();
 
+  const loot::heroic::HeroicSnapshot snapshot(rootPath_);
+
   const auto folder = "Fallout3";
-  const auto path =
-      loot::heroic::GetGameLocalPath(rootPath_, "1454315831", folder);
+  const auto path = snapshot.GetGameLocalPath("1454315831", folder);
 
   const auto expectedPath = std::filesystem::u8path(
                                 "/home/user/Games/Heroic/default/pfx/drive_c/"
@@ -236,6 +309,7 @@ TEST_F(Heroic_GetGameLocalPathTest,
                             folder;
   EXPECT_EQ(expectedPath.generic_u8string(), path.generic_u8string());
 }
+#endif
 
 class Heroic_FindGameInstallsTest : public HeroicTest {};
 TEST_F(Heroic_FindGameInstallsTest,
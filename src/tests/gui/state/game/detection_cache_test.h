@@ -0,0 +1,177 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_DETECTION_CACHE_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_DETECTION_CACHE_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "gui/state/game/detection_cache.h"
+#include "tests/common_game_test_fixture.h"
+#include "tests/gui/state/game/detection/test_registry.h"
+
+namespace loot::test {
+TEST(RecordingRegistry, shouldReturnTheResultsOfTheWrappedRegistry) {
+  TestRegistry registry;
+  registry.SetStringValue("key", "value");
+  registry.SetSubKeys("key", {"a", "b"});
+
+  const RecordingRegistry recordingRegistry(registry);
+
+  EXPECT_EQ("value",
+            recordingRegistry.GetStringValue({"root", "key", "name"}).value());
+  EXPECT_EQ(std::vector<std::string>({"a", "b"}),
+            recordingRegistry.GetSubKeys("root", "key"));
+}
+
+TEST(RecordingRegistry, shouldRecordEachQueryOnce) {
+  TestRegistry registry;
+  const RecordingRegistry recordingRegistry(registry);
+
+  recordingRegistry.GetStringValue({"root", "key1", "name"});
+  recordingRegistry.GetStringValue({"root", "key2", "name"});
+  recordingRegistry.GetStringValue({"root", "key1", "name"});
+  recordingRegistry.GetSubKeys("root", "key1");
+  recordingRegistry.GetSubKeys("root", "key1");
+
+  ASSERT_EQ(2, recordingRegistry.GetQueriedValues().size());
+  EXPECT_EQ("key1", recordingRegistry.GetQueriedValues()[0].subKey);
+  EXPECT_EQ("key2", recordingRegistry.GetQueriedValues()[1].subKey);
+
+  ASSERT_EQ(1, recordingRegistry.GetQueriedSubKeys().size());
+  EXPECT_EQ("key1", recordingRegistry.GetQueriedSubKeys()[0].second);
+}
+
+class DetectionCacheTest : public CommonGameTestFixture {
+protected:
+  DetectionCacheTest() :
+      CommonGameTestFixture(GameId::tes5se),
+      cachePath(lootDataPath / "detection_cache.bin"),
+      installPath(dataPath.parent_path()) {
+    registry.SetStringValue(
+        "Software\\Bethesda Softworks\\Skyrim Special Edition",
+        installPath.u8string());
+  }
+
+  std::vector<GameInstall> findGameInstalls() const {
+    return FindGameInstalls(cachePath, registry, {}, {}, {});
+  }
+
+  const std::filesystem::path cachePath;
+  const std::filesystem::path installPath;
+
+  TestRegistry registry;
+};
+
+TEST_F(DetectionCacheTest, shouldDetectInstallsAndCacheThemIfThereIsNoCache) {
+  const auto installs = findGameInstalls();
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ(GameId::tes5se, installs[0].gameId);
+  EXPECT_EQ(installPath, installs[0].installPath);
+  EXPECT_TRUE(std::filesystem::exists(cachePath));
+}
+
+TEST_F(DetectionCacheTest, shouldReuseCachedInstallsIfNoSourcesHaveChanged) {
+  findGameInstalls();
+
+  // Detection checks that the master file exists, but the cache doesn't.
+  std::filesystem::remove(dataPath / masterFile);
+
+  const auto installs = findGameInstalls();
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ(installPath, installs[0].installPath);
+}
+
+TEST_F(DetectionCacheTest,
+       shouldDetectInstallsAgainIfARegistryValueThatWasReadHasChanged) {
+  findGameInstalls();
+
+  registry.SetStringValue(
+      "Software\\Bethesda Softworks\\Skyrim Special Edition",
+      missingPath.u8string());
+
+  EXPECT_TRUE(findGameInstalls().empty());
+}
+
+TEST_F(DetectionCacheTest,
+       shouldDetectInstallsAgainIfACachedInstallHasBeenRemoved) {
+  findGameInstalls();
+
+  std::filesystem::remove_all(installPath);
+
+  EXPECT_TRUE(findGameInstalls().empty());
+}
+
+TEST_F(DetectionCacheTest, shouldDetectInstallsAgainIfTheCacheIsInvalid) {
+  std::ofstream out(cachePath, std::ios_base::out | std::ios_base::binary);
+  out << "invalid";
+  out.close();
+
+  const auto installs = findGameInstalls();
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ(installPath, installs[0].installPath);
+}
+
+TEST_F(DetectionCacheTest, shouldNotLeaveATemporaryFileBehind) {
+  findGameInstalls();
+
+  auto tempPath = cachePath;
+  tempPath += ".tmp";
+
+  EXPECT_TRUE(std::filesystem::exists(cachePath));
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+}
+
+#ifdef _WIN32
+TEST_F(DetectionCacheTest,
+       shouldDetectInstallsAgainIfTheCurrentPathHasChanged) {
+  registry.SetStringValue(
+      "Software\\Bethesda Softworks\\Skyrim Special Edition",
+      missingPath.u8string());
+
+  EXPECT_TRUE(findGameInstalls().empty());
+
+  // Move into a game subfolder so that the game is found as LOOT's sibling.
+  const auto initialCurrentPath = std::filesystem::current_path();
+  const auto lootPath = installPath / "LOOT";
+  std::filesystem::create_directory(lootPath);
+  std::filesystem::current_path(lootPath);
+
+  const auto installs = findGameInstalls();
+
+  std::filesystem::current_path(initialCurrentPath);
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ(installPath, installs[0].installPath);
+}
+#endif
+}
+
+#endif
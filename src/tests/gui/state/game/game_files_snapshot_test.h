@@ -0,0 +1,201 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_GAME_FILES_SNAPSHOT_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_GAME_FILES_SNAPSHOT_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "gui/state/game/game_files_snapshot.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class GameFilesSnapshotTest : public ::testing::Test {
+protected:
+  GameFilesSnapshotTest() :
+      rootPath(getTempPath()),
+      externalDataPath(rootPath / "external"),
+      dataPath(rootPath / "Data"),
+      loadOrderFilePath(rootPath / "plugins.txt") {}
+
+  void SetUp() override {
+    std::filesystem::create_directories(externalDataPath);
+    std::filesystem::create_directories(dataPath / "BashTags");
+  }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath); }
+
+  void writeFile(const std::filesystem::path& path,
+                 const std::string& content) {
+    std::ofstream out(path);
+    out << content;
+  }
+
+  GameFilesSnapshot takeSnapshot() const {
+    return TakeGameFilesSnapshot({externalDataPath, dataPath},
+                                 {loadOrderFilePath});
+  }
+
+  const std::filesystem::path rootPath;
+  const std::filesystem::path externalDataPath;
+  const std::filesystem::path dataPath;
+  const std::filesystem::path loadOrderFilePath;
+};
+
+TEST_F(GameFilesSnapshotTest,
+       takeSnapshotShouldOnlyIncludeFilesWithPluginFileExtensions) {
+  writeFile(dataPath / "Blank.esm", "1");
+  writeFile(dataPath / "Blank.esp", "1");
+  writeFile(dataPath / "Blank.esl", "1");
+  writeFile(dataPath / "Blank.bsa", "1");
+  writeFile(dataPath / "Blank.txt", "1");
+
+  const auto snapshot = takeSnapshot();
+
+  ASSERT_EQ(3, snapshot.plugins.size());
+  EXPECT_EQ(1, snapshot.plugins.count(Filename("Blank.esm")));
+  EXPECT_EQ(1, snapshot.plugins.count(Filename("Blank.esp")));
+  EXPECT_EQ(1, snapshot.plugins.count(Filename("Blank.esl")));
+}
+
+TEST_F(GameFilesSnapshotTest,
+       takeSnapshotShouldKeyGhostedPluginsByUnghostedName) {
+  writeFile(dataPath / "Blank.esp.GHOST", "1");
+
+  const auto snapshot = takeSnapshot();
+
+  ASSERT_EQ(1, snapshot.plugins.size());
+  EXPECT_EQ(1, snapshot.plugins.count(Filename("blank.esp")));
+}
+
+TEST_F(GameFilesSnapshotTest,
+       takeSnapshotShouldPreferPluginsInEarlierDirectories) {
+  writeFile(externalDataPath / "Blank.esp", "12");
+  writeFile(dataPath / "Blank.esp", "1");
+
+  const auto snapshot = takeSnapshot();
+
+  ASSERT_EQ(1, snapshot.plugins.size());
+  EXPECT_EQ(2, snapshot.plugins.at(Filename("Blank.esp")).size);
+}
+
+TEST_F(GameFilesSnapshotTest,
+       takeSnapshotShouldKeyBashTagsFilesByBasenameAndIgnoreOtherFiles) {
+  writeFile(dataPath / "BashTags" / "Blank.txt", "Delev");
+  writeFile(dataPath / "BashTags" / "Blank.md", "Delev");
+
+  const auto snapshot = takeSnapshot();
+
+  ASSERT_EQ(1, snapshot.bashTagsFiles.size());
+  EXPECT_EQ(1, snapshot.bashTagsFiles.count(Filename("blank")));
+}
+
+TEST_F(GameFilesSnapshotTest,
+       takeSnapshotShouldOnlyIncludeLoadOrderFilesThatExist) {
+  auto snapshot = takeSnapshot();
+
+  EXPECT_TRUE(snapshot.loadOrderFiles.empty());
+
+  writeFile(loadOrderFilePath, "*Blank.esp");
+
+  snapshot = takeSnapshot();
+
+  EXPECT_EQ(1, snapshot.loadOrderFiles.count(loadOrderFilePath));
+}
+
+TEST(GetGameFilesChanges, shouldBeEmptyIfTheSnapshotsAreEqual) {
+  GameFilesSnapshot snapshot;
+  snapshot.plugins.emplace(Filename("Blank.esp"), GameFileState{1});
+  snapshot.bashTagsFiles.emplace(Filename("Blank"), GameFileState{1});
+  snapshot.loadOrderFiles.emplace("plugins.txt", GameFileState{1});
+
+  EXPECT_TRUE(GetGameFilesChanges(snapshot, snapshot).IsEmpty());
+}
+
+TEST(GetGameFilesChanges, shouldIncludeAddedRemovedAndModifiedPlugins) {
+  GameFilesSnapshot before;
+  before.plugins.emplace(Filename("Removed.esp"), GameFileState{1});
+  before.plugins.emplace(Filename("Modified.esp"), GameFileState{1});
+  before.plugins.emplace(Filename("Unchanged.esp"), GameFileState{1});
+
+  GameFilesSnapshot after;
+  after.plugins.emplace(Filename("Added.esp"), GameFileState{1});
+  after.plugins.emplace(Filename("Modified.esp"), GameFileState{2});
+  after.plugins.emplace(Filename("Unchanged.esp"), GameFileState{1});
+
+  const auto changes = GetGameFilesChanges(before, after);
+
+  const std::set<Filename> expectedPlugins{
+      Filename("Added.esp"), Filename("Modified.esp"), Filename("Removed.esp")};
+  EXPECT_EQ(expectedPlugins, changes.plugins);
+  EXPECT_TRUE(changes.bashTagsFiles.empty());
+  EXPECT_FALSE(changes.loadOrder);
+}
+
+TEST(GetGameFilesChanges, shouldIncludeChangedBashTagsFiles) {
+  GameFilesSnapshot before;
+  GameFilesSnapshot after;
+  after.bashTagsFiles.emplace(Filename("Blank"), GameFileState{1});
+
+  const auto changes = GetGameFilesChanges(before, after);
+
+  EXPECT_TRUE(changes.plugins.empty());
+  EXPECT_EQ(std::set<Filename>{Filename("Blank")}, changes.bashTagsFiles);
+  EXPECT_FALSE(changes.loadOrder);
+}
+
+TEST(GetGameFilesChanges, shouldSetLoadOrderIfALoadOrderFileChanged) {
+  GameFilesSnapshot before;
+  before.loadOrderFiles.emplace("plugins.txt", GameFileState{1});
+  GameFilesSnapshot after;
+  after.loadOrderFiles.emplace("plugins.txt", GameFileState{2});
+
+  EXPECT_TRUE(GetGameFilesChanges(before, after).loadOrder);
+}
+
+TEST(GameFilesChanges, mergeShouldCombineBothSetsOfChanges) {
+  GameFilesChanges changes;
+  changes.plugins.insert(Filename("A.esp"));
+
+  GameFilesChanges other;
+  other.plugins.insert(Filename("B.esp"));
+  other.bashTagsFiles.insert(Filename("B"));
+  other.loadOrder = true;
+
+  changes.Merge(other);
+
+  const std::set<Filename> expectedPlugins{Filename("A.esp"),
+                                           Filename("B.esp")};
+  EXPECT_EQ(expectedPlugins, changes.plugins);
+  EXPECT_EQ(std::set<Filename>{Filename("B")}, changes.bashTagsFiles);
+  EXPECT_TRUE(changes.loadOrder);
+}
+}
+}
+
+#endif
@@ -25,6 +25,7 @@ along with LOOT.  If not, see
 #ifndef LOOT_TESTS_GUI_STATE_GAME_GAME_TEST
 #define LOOT_TESTS_GUI_STATE_GAME_GAME_TEST
 
+#include <algorithm>
 #include <fstream>
 
 #include "gui/state/game/game.h"
@@ -303,6 +304,31 @@ TEST_P(GameTest, checkInstallValidityShouldCheckThatRequirementsArePresent) {
             messages);
 }
 
+TEST_P(GameTest,
+       checkInstallValidityShouldCheckForConflictsWithBashTagsFiles) {
+  std::filesystem::create_directories(dataPath / "BashTags");
+  std::ofstream out(dataPath / "BashTags" / "blank.TXT");
+  out << "C.Location, -Relev";
+  out.close();
+
+  Game game = CreateInitialisedGame();
+  game.LoadAllInstalledPlugins(true);
+
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev"), Tag("C.Location")});
+
+  auto messages =
+      game.CheckInstallValidity(*game.GetPlugin(blankEsm), metadata, "en");
+  EXPECT_EQ(std::vector<SourcedMessage>({
+                SourcedMessage{MessageType::say,
+                               MessageSource::bashTagsOverride,
+                               "This plugin has a BashTags file that will "
+                               "override the suggestions made by LOOT for the "
+                               "following Bash Tags: Relev\\."},
+            }),
+            messages);
+}
+
 TEST_P(GameTest,
        checkInstallValidityShouldHandleNonAsciiFileMetadataCorrectly) {
   using std::filesystem::u8path;
@@ -1034,6 +1060,60 @@ TEST_P(GameTest, sortPluginsShouldSupportPluginsAtExternalPaths) {
             loadOrder);
 }
 
+TEST_P(GameTest,
+       sortPluginsShouldNotUseACachedResultIfAConditionTestsANonPluginFile) {
+  Game game = CreateInitialisedGame();
+  game.LoadAllInstalledPlugins(true);
+
+  PluginMetadata metadata(blankEsp);
+  metadata.SetLoadAfterFiles(
+      {File(blankDifferentEsp, "", "file(\"Blank.bsa\")")});
+  game.AddUserMetadata(metadata);
+
+  auto loadOrder = game.SortPlugins();
+
+  auto blankEspIt = std::find(loadOrder.begin(), loadOrder.end(), blankEsp);
+  auto blankDifferentEspIt =
+      std::find(loadOrder.begin(), loadOrder.end(), blankDifferentEsp);
+  EXPECT_LT(blankEspIt, blankDifferentEspIt);
+
+  loot::test::touch(dataPath / "Blank.bsa");
+
+  loadOrder = game.SortPlugins();
+
+  blankEspIt = std::find(loadOrder.begin(), loadOrder.end(), blankEsp);
+  blankDifferentEspIt =
+      std::find(loadOrder.begin(), loadOrder.end(), blankDifferentEsp);
+  EXPECT_GT(blankEspIt, blankDifferentEspIt);
+}
+
+TEST_P(GameTest, prepareForSortingShouldGetAPathForEachPluginInTheLoadOrder) {
+  Game game = CreateInitialisedGame();
+  game.LoadAllInstalledPlugins(true);
+
+  const auto preparation = game.PrepareForSorting();
+
+  EXPECT_EQ(game.GetLoadOrder(), preparation.loadOrder);
+  EXPECT_EQ(preparation.loadOrder.size(), preparation.pluginPaths.size());
+}
+
+TEST_P(GameTest, sortPluginsWithAPreparationShouldSortTheSameWayAsWithout) {
+  Game game = CreateInitialisedGame();
+  game.LoadAllInstalledPlugins(true);
+
+  const auto preparation = game.PrepareForSorting();
+  const auto sortedPlugins = game.SortPlugins();
+
+  // Remove the sort cache so that the second sort doesn't just reuse the
+  // result of the first.
+  std::filesystem::remove(
+      lootDataPath / "games" /
+      std::filesystem::u8path(game.GetSettings().FolderName()) /
+      "sort_cache.bin");
+
+  EXPECT_EQ(sortedPlugins, game.SortPlugins(preparation));
+}
+
 TEST_P(GameTest,
        incrementLoadOrderSortCountShouldSupressTheDefaultCachedMessage) {
   Game game = CreateInitialisedGame();
@@ -1088,6 +1168,147 @@ TEST_P(
 #endif
 }
 
+TEST_P(GameTest, flushingUserMetadataShouldWriteTheScheduledUserlist) {
+  Game game = CreateInitialisedGame();
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev")});
+  game.AddUserMetadata(metadata);
+
+  game.SaveUserMetadata();
+  game.FlushUserMetadata();
+
+  ASSERT_TRUE(std::filesystem::exists(game.UserlistPath()));
+
+  auto tempPath = game.UserlistPath();
+  tempPath += ".tmp";
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+
+  std::ifstream in(game.UserlistPath());
+  const std::string content((std::istreambuf_iterator<char>(in)),
+                            std::istreambuf_iterator<char>());
+  EXPECT_NE(std::string::npos, content.find(blankEsm));
+}
+
+TEST_P(GameTest, destroyingTheGameShouldWriteAnyScheduledUserlist) {
+  std::filesystem::path userlistPath;
+  {
+    Game game = CreateInitialisedGame();
+    userlistPath = game.UserlistPath();
+    PluginMetadata metadata(blankEsm);
+    metadata.SetTags({Tag("Relev")});
+    game.AddUserMetadata(metadata);
+    game.SaveUserMetadata();
+  }
+
+  EXPECT_TRUE(std::filesystem::exists(userlistPath));
+}
+
+TEST_P(GameTest, loadingMetadataShouldKeepUserMetadataScheduledToBeSaved) {
+  Game game = CreateInitialisedGame();
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev")});
+  game.AddUserMetadata(metadata);
+  game.SaveUserMetadata();
+
+  game.LoadMetadata();
+
+  const auto userMetadata = game.GetUserMetadata(blankEsm);
+  ASSERT_TRUE(userMetadata.has_value());
+  EXPECT_EQ(1, userMetadata.value().GetTags().size());
+}
+
+TEST_P(GameTest,
+       flushingUserMetadataShouldThrowOnlyIfTheLastWriteFailedWithNoHandler) {
+  Game game = CreateInitialisedGame();
+
+  // Writing fails if the userlist path is a directory.
+  std::filesystem::create_directories(game.UserlistPath());
+
+  game.SaveUserMetadata();
+  EXPECT_ANY_THROW(game.FlushUserMetadata());
+
+  std::filesystem::remove(game.UserlistPath());
+
+  game.SaveUserMetadata();
+  EXPECT_NO_THROW(game.FlushUserMetadata());
+  EXPECT_TRUE(std::filesystem::is_regular_file(game.UserlistPath()));
+}
+
+TEST_P(GameTest,
+       flushingUserMetadataShouldNotThrowIfTheWriteErrorWasHandled) {
+  Game game = CreateInitialisedGame();
+
+  size_t errorCount = 0;
+  game.SetUserMetadataWriteErrorHandler(
+      [&](const std::string&) { errorCount += 1; });
+
+  std::filesystem::create_directories(game.UserlistPath());
+
+  game.SaveUserMetadata();
+  EXPECT_NO_THROW(game.FlushUserMetadata());
+  EXPECT_EQ(1, errorCount);
+}
+
+TEST_P(GameTest, flushingUserMetadataWithNothingScheduledShouldDoNothing) {
+  Game game = CreateInitialisedGame();
+
+  EXPECT_NO_THROW(game.FlushUserMetadata());
+  EXPECT_FALSE(std::filesystem::exists(game.UserlistPath()));
+}
+
+TEST_P(GameTest,
+       applyingAUserMetadataTransactionShouldReturnEachEditedPluginOnce) {
+  Game game = CreateInitialisedGame();
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev")});
+
+  UserMetadataTransaction transaction;
+  transaction.SetUserGroups({Group("group1")});
+  transaction.ReplaceUserMetadata(metadata);
+  transaction.SetPluginGroup(blankEsp, "group1");
+  transaction.SetPluginGroup(blankEsm, "group1");
+
+  const auto pluginNames = game.ApplyUserMetadataTransaction(transaction);
+
+  EXPECT_EQ(std::vector<std::string>({blankEsm, blankEsp}), pluginNames);
+  ASSERT_EQ(1, game.GetUserGroups().size());
+  EXPECT_EQ("group1", game.GetUserGroups()[0].GetName());
+
+  const auto esmMetadata = game.GetUserMetadata(blankEsm);
+  ASSERT_TRUE(esmMetadata.has_value());
+  EXPECT_EQ("group1", esmMetadata.value().GetGroup());
+  EXPECT_EQ(std::vector<Tag>({Tag("Relev")}), esmMetadata.value().GetTags());
+
+  const auto espMetadata = game.GetUserMetadata(blankEsp);
+  ASSERT_TRUE(espMetadata.has_value());
+  EXPECT_EQ("group1", espMetadata.value().GetGroup());
+}
+
+TEST_P(GameTest,
+       applyingAUserMetadataTransactionShouldDiscardNameOnlyReplacements) {
+  Game game = CreateInitialisedGame();
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev")});
+  game.AddUserMetadata(metadata);
+
+  UserMetadataTransaction transaction;
+  transaction.ReplaceUserMetadata(PluginMetadata(blankEsm));
+  game.ApplyUserMetadataTransaction(transaction);
+
+  EXPECT_FALSE(game.GetUserMetadata(blankEsm).has_value());
+}
+
+TEST_P(GameTest, applyingAUserMetadataTransactionShouldScheduleAUserlistWrite) {
+  Game game = CreateInitialisedGame();
+
+  UserMetadataTransaction transaction;
+  transaction.SetPluginGroup(blankEsm, "default");
+  game.ApplyUserMetadataTransaction(transaction);
+  game.FlushUserMetadata();
+
+  EXPECT_TRUE(std::filesystem::exists(game.UserlistPath()));
+}
+
 TEST_P(GameTest, appendingMessagesShouldStoreThemInTheGivenOrder) {
   Game game = CreateInitialisedGame();
   std::vector<SourcedMessage> messages({
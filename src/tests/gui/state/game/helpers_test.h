@@ -161,6 +161,44 @@ TEST(ReadBashTagsFile, shouldReadFromAPluginFile) {
   std::filesystem::remove_all(dataPath);
 }
 
+TEST(ReadBashTagsFiles, shouldReturnAnEmptyMapIfTheDirectoryDoesNotExist) {
+  EXPECT_TRUE(
+      ReadBashTagsFiles(std::filesystem::temp_directory_path() / "missing")
+          .empty());
+}
+
+TEST(ReadBashTagsFiles, shouldReadAllTxtFilesKeyedCaseInsensitivelyByBasename) {
+  const auto dataPath = getTempPath();
+  const auto bashTagsDir = dataPath / "BashTags";
+
+  std::filesystem::create_directories(bashTagsDir);
+
+  std::ofstream out(bashTagsDir / "Blank.txt");
+  out << "C.Location, Delev, -Relev";
+  out.close();
+
+  out.open(bashTagsDir / "Other.TXT");
+  out << "Relev";
+  out.close();
+
+  out.open(bashTagsDir / "Ignored.md");
+  out << "Delev";
+  out.close();
+
+  const auto bashTagsFiles = ReadBashTagsFiles(dataPath);
+
+  ASSERT_EQ(2, bashTagsFiles.size());
+
+  const std::vector<Tag> expectedBlankTags{
+      Tag("C.Location"), Tag("Delev"), Tag("Relev", false)};
+  EXPECT_EQ(expectedBlankTags, bashTagsFiles.at(Filename("blank")));
+
+  const std::vector<Tag> expectedOtherTags{Tag("Relev")};
+  EXPECT_EQ(expectedOtherTags, bashTagsFiles.at(Filename("OTHER")));
+
+  std::filesystem::remove_all(dataPath);
+}
+
 TEST(GetTagConflicts,
      shouldReturnTagNamesAddedByOneSourceAndRemovedByTheOther) {
   const auto conflicts =
@@ -243,6 +281,26 @@ TEST(GetExternalDataPaths,
                             "(PC)/Content/Data"}),
             paths);
 }
+
+TEST(IsOfficialPlugin, shouldReturnTrueForAGamesOfficialPlugins) {
+  EXPECT_TRUE(IsOfficialPlugin(GameId::tes3, "morrowind.esm"));
+  EXPECT_TRUE(IsOfficialPlugin(GameId::nehrim, "nehrim.esm"));
+  EXPECT_TRUE(IsOfficialPlugin(GameId::tes5se, "ccbgssse001-fish.esm"));
+  EXPECT_TRUE(IsOfficialPlugin(GameId::fo4vr, "fallout4_vr.esm"));
+}
+
+TEST(IsOfficialPlugin, shouldBeCaseInsensitive) {
+  EXPECT_TRUE(IsOfficialPlugin(GameId::tes3, "Morrowind.esm"));
+  EXPECT_TRUE(IsOfficialPlugin(GameId::fo4vr, "FALLOUT4_VR.ESM"));
+}
+
+TEST(IsOfficialPlugin, shouldReturnFalseForOtherPlugins) {
+  EXPECT_FALSE(IsOfficialPlugin(GameId::tes3, "Blank.esm"));
+  EXPECT_FALSE(IsOfficialPlugin(GameId::tes3, "morrowind.esm.ghost"));
+  EXPECT_FALSE(IsOfficialPlugin(GameId::tes3, ""));
+  EXPECT_FALSE(IsOfficialPlugin(GameId::nehrim, "oblivion.esm"));
+  EXPECT_FALSE(IsOfficialPlugin(GameId::tes4, "skyrim.esm"));
+}
 }
 }
 
@@ -0,0 +1,120 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_SORT_CACHE_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_SORT_CACHE_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "gui/state/game/sort_cache.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class SortCacheTest : public ::testing::Test {
+protected:
+  SortCacheTest() :
+      rootPath(getTempPath()), cachePath(rootPath / "sort_cache.bin") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath); }
+
+  void writeFile(const std::filesystem::path& path,
+                 const std::string& content) {
+    std::ofstream out(path, std::ios_base::out | std::ios_base::binary);
+    out << content;
+  }
+
+  const std::filesystem::path rootPath;
+  const std::filesystem::path cachePath;
+};
+
+TEST_F(SortCacheTest, getCachedSortResultShouldReturnNulloptIfNoFileExists) {
+  EXPECT_FALSE(GetCachedSortResult(cachePath, 1).has_value());
+}
+
+TEST_F(SortCacheTest, getCachedSortResultShouldThrowIfTheFileIsInvalid) {
+  writeFile(cachePath, "invalid");
+
+  EXPECT_THROW(GetCachedSortResult(cachePath, 1), std::runtime_error);
+}
+
+TEST_F(SortCacheTest, getCachedSortResultShouldReturnTheResultForTheHash) {
+  const std::vector<std::string> result1{"A.esm", "B.esp"};
+  const std::vector<std::string> result2{"B.esp", "A.esm"};
+
+  CacheSortResult(cachePath, 1, result1);
+  CacheSortResult(cachePath, 2, result2);
+
+  EXPECT_EQ(result1, GetCachedSortResult(cachePath, 1));
+  EXPECT_EQ(result2, GetCachedSortResult(cachePath, 2));
+  EXPECT_FALSE(GetCachedSortResult(cachePath, 3).has_value());
+}
+
+TEST_F(SortCacheTest, cacheSortResultShouldReplaceAResultWithTheSameHash) {
+  const std::vector<std::string> result1{"A.esm", "B.esp"};
+  const std::vector<std::string> result2{"B.esp", "A.esm"};
+
+  CacheSortResult(cachePath, 1, result1);
+  CacheSortResult(cachePath, 1, result2);
+
+  EXPECT_EQ(result2, GetCachedSortResult(cachePath, 1));
+}
+
+TEST_F(SortCacheTest, cacheSortResultShouldDiscardTheOldestResults) {
+  for (uint64_t hash = 1; hash <= 5; hash += 1) {
+    CacheSortResult(cachePath, hash, {std::to_string(hash)});
+  }
+
+  EXPECT_FALSE(GetCachedSortResult(cachePath, 1).has_value());
+  EXPECT_TRUE(GetCachedSortResult(cachePath, 2).has_value());
+  EXPECT_TRUE(GetCachedSortResult(cachePath, 5).has_value());
+}
+
+TEST_F(SortCacheTest, cacheSortResultShouldOverwriteAnInvalidFile) {
+  writeFile(cachePath, "invalid");
+
+  CacheSortResult(cachePath, 1, {"A.esm"});
+
+  EXPECT_EQ(std::vector<std::string>{"A.esm"},
+            GetCachedSortResult(cachePath, 1));
+}
+
+TEST_F(SortCacheTest, cacheSortResultShouldNotLeaveATemporaryFileBehind) {
+  CacheSortResult(cachePath, 1, {"A.esm"});
+
+  auto tempPath = cachePath;
+  tempPath += ".tmp";
+
+  EXPECT_TRUE(std::filesystem::exists(cachePath));
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+}
+}
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2023    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_LOG_CENSOR_TEST
+#define LOOT_TESTS_GUI_STATE_LOG_CENSOR_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/state/log_censor.h"
+
+namespace loot {
+namespace test {
+TEST(LogCensor, censorShouldReturnFalseAndNotChangeOutputIfNothingMatches) {
+  const LogCensor censor({{"/home/user", "$HOME"}, {"C:\\Users", "%USERS%"}});
+
+  std::string output = "unchanged";
+  EXPECT_FALSE(censor.censor("/usr/share/loot", output));
+  EXPECT_EQ("unchanged", output);
+}
+
+TEST(LogCensor, censorShouldReturnFalseIfThereAreNoStringsToCensor) {
+  const LogCensor censor;
+
+  std::string output;
+  EXPECT_FALSE(censor.censor("/home/user", output));
+}
+
+TEST(LogCensor, shouldIgnoreEmptyStringsToCensor) {
+  const LogCensor censor(
+      std::vector<std::pair<std::string, std::string>>{{"", "empty"}});
+
+  std::string output;
+  EXPECT_FALSE(censor.censor("text", output));
+  EXPECT_TRUE(censor.getStringsToCensor().empty());
+}
+
+TEST(LogCensor, censorShouldReplaceEveryOccurrenceOfEveryString) {
+  const LogCensor censor(
+      {{"/home/user", "$HOME"}, {"C:\\Users\\user", "%USERPROFILE%"}});
+
+  std::string output;
+  EXPECT_TRUE(censor.censor(
+      "/home/user/a, C:\\Users\\user\\b and /home/user/c", output));
+  EXPECT_EQ("$HOME/a, %USERPROFILE%\\b and $HOME/c", output);
+}
+
+TEST(LogCensor,
+     censorShouldPreferTheLongestOfMatchesStartingAtTheSamePosition) {
+  const LogCensor censor(
+      {{"/home/user", "$HOME"}, {"/home/user/.steam/steam", "$STEAM"}});
+
+  std::string output;
+  EXPECT_TRUE(
+      censor.censor("/home/user/.steam/steam/a and /home/user/b", output));
+  EXPECT_EQ("$STEAM/a and $HOME/b", output);
+}
+
+TEST(LogCensor, censorShouldPreferTheLeftmostOfOverlappingMatches) {
+  const LogCensor censor({{"abcd", "1"}, {"bc", "2"}, {"c", "3"}});
+
+  std::string output;
+  EXPECT_TRUE(censor.censor("abcabcd", output));
+  EXPECT_EQ("a21", output);
+}
+
+TEST(LogCensor, censorShouldReplaceTheOutputContent) {
+  const LogCensor censor({{"a", "b"}, {"c", "d"}});
+
+  std::string output = "previous content";
+  EXPECT_TRUE(censor.censor("aaa", output));
+  EXPECT_EQ("bbb", output);
+}
+}
+}
+
+#endif
@@ -87,6 +87,8 @@ TEST_F(LootSettingsTest, defaultConstructorShouldSetDefaultValues) {
   EXPECT_FALSE(settings_.isDebugLoggingEnabled());
   EXPECT_TRUE(settings_.isMasterlistUpdateBeforeSortEnabled());
   EXPECT_TRUE(settings_.isLootUpdateCheckEnabled());
+  EXPECT_FALSE(settings_.isIncrementalBackupEnabled());
+  EXPECT_FALSE(settings_.isGameFilesWatchingEnabled());
   EXPECT_EQ("auto", settings_.getGame());
   EXPECT_EQ("auto", settings_.getLastGame());
   EXPECT_TRUE(settings_.getLastVersion().empty());
@@ -135,6 +137,8 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
   out << "enableDebugLogging = true" << endl
       << "updateMasterlist = true" << endl
       << "enableLootUpdateCheck = false" << endl
+      << "useIncrementalBackups = true" << endl
+      << "watchGameFiles = true" << endl
       << "game = \"Oblivion\"" << endl
       << "lastGame = \"Skyrim\"" << endl
       << "language = \"fr\"" << endl
@@ -174,6 +178,8 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
   EXPECT_TRUE(settings_.isDebugLoggingEnabled());
   EXPECT_TRUE(settings_.isMasterlistUpdateBeforeSortEnabled());
   EXPECT_FALSE(settings_.isLootUpdateCheckEnabled());
+  EXPECT_TRUE(settings_.isIncrementalBackupEnabled());
+  EXPECT_TRUE(settings_.isGameFilesWatchingEnabled());
   EXPECT_EQ("Oblivion", settings_.getGame());
   EXPECT_EQ("Skyrim", settings_.getLastGame());
   EXPECT_EQ("0.7.1", settings_.getLastVersion());